@@ -0,0 +1,91 @@
+/**
+ * This file counts the heap allocations of a benchmark executable by replacing the global
+ * allocation functions. It must be included by exactly one translation unit of an executable.
+ *
+ *        File: AllocCounter.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<uint64_t> numAllocs{0}; ///< Number of calls to the global allocation function
+std::atomic<uint64_t> numBytes{0};  ///< Number of bytes requested from the allocation function
+
+}  // namespace
+
+/*
+ * The replaceable global allocation functions count every allocation in the process, including
+ * those made by the standard library on behalf of the library under test.
+ */
+
+void* operator new(const std::size_t size)
+{
+    numAllocs.fetch_add(1, std::memory_order_relaxed);
+    numBytes.fetch_add(size, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* const ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* const ptr, const std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace {
+
+/// Counts the heap allocations made by the timed loop of a benchmark.
+class AllocCounter final
+{
+    uint64_t allocs;    ///< Number of allocations at construction
+    uint64_t bytes;     ///< Number of allocated bytes at construction
+
+public:
+    /// Constructs. Starts counting.
+    AllocCounter()
+        : allocs(numAllocs.load())
+        , bytes(numBytes.load())
+    {}
+
+    /**
+     * Reports the number of allocations and allocated bytes per iteration since construction.
+     * @param[in,out] state  Benchmark state
+     */
+    void report(benchmark::State& state) const
+    {
+        state.counters["allocs/op"] = benchmark::Counter(numAllocs.load() - allocs,
+                benchmark::Counter::kAvgIterations);
+        state.counters["bytes/op"] = benchmark::Counter(numBytes.load() - bytes,
+                benchmark::Counter::kAvgIterations);
+    }
+};
+
+}  // namespace
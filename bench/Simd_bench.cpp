@@ -0,0 +1,137 @@
+/**
+ * This file benchmarks the vectorized conversion kernels of class Simd. The throughput of each
+ * instruction-set architecture is reported in bytes read and written per second.
+ *
+ *        File: Simd_bench.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Simd.h"
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using namespace quantity;
+
+/**
+ * Benchmarks a linear kernel. Argument 0 is the instruction-set architecture; argument 1 is the
+ * number of values.
+ * @param[in] state  Benchmark state
+ */
+void BM_Linear(benchmark::State& state)
+{
+    const auto isa = static_cast<Simd::Isa>(state.range(0));
+    const auto n = static_cast<size_t>(state.range(1));
+
+    if (!Simd::isSupported(isa)) {
+        state.SkipWithError("Instruction-set architecture isn't supported");
+        return;
+    }
+
+    const auto          kernel = Simd::linearKernel(isa);
+    std::vector<double> in(n, 212.0);
+    std::vector<double> out(n);
+
+    for (auto _ : state) {
+        kernel(in.data(), out.data(), n, 32, 5.0/9.0, 273.15);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetLabel(Simd::to_string(isa));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*n*2*sizeof(double));
+}
+
+// Sizes that fit in L1, fit in L2, and stream from memory
+BENCHMARK(BM_Linear)->ArgsProduct({
+        {static_cast<int>(Simd::Isa::SCALAR), static_cast<int>(Simd::Isa::SSE2),
+         static_cast<int>(Simd::Isa::AVX2),   static_cast<int>(Simd::Isa::AVX512)},
+        {1 << 10, 1 << 15, 1 << 23}});
+
+/**
+ * Benchmarks a transcendental kernel against the C math library.
+ * @param[in] state   Benchmark state. Argument 0 is the instruction-set architecture or -1 for the
+ *                    C math library; argument 1 is the number of values.
+ * @param[in] kernel  Returns the kernel for an instruction-set architecture
+ * @param[in] libm    The C math library function
+ * @param[in] first   The first input value
+ */
+void transcendental(benchmark::State&            state,
+                    Simd::TranscendentalKernel (*kernel)(Simd::Isa),
+                    double                     (*libm)(double),
+                    const double                 first)
+{
+    const size_t n = state.range(1);
+    std::vector<double> in(n);
+    std::vector<double> out(n);
+    for (size_t i = 0; i < n; ++i)
+        in[i] = first + i*(100.0/n);
+
+    if (state.range(0) < 0) {
+        for (auto _ : state) {
+            for (size_t i = 0; i < n; ++i)
+                out[i] = libm(in[i]);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetLabel("libm");
+    }
+    else {
+        const auto isa = static_cast<Simd::Isa>(state.range(0));
+        if (!Simd::isSupported(isa)) {
+            state.SkipWithError("Unsupported instruction-set architecture");
+            return;
+        }
+        const auto func = kernel(isa);
+        for (auto _ : state) {
+            func(in.data(), out.data(), n, 1);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetLabel(Simd::to_string(isa));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*n);
+}
+
+/**
+ * Benchmarks the exponential kernels. Argument 0 is the instruction-set architecture or -1 for the C
+ * math library; argument 1 is the number of values.
+ * @param[in] state  Benchmark state
+ */
+void BM_Exp(benchmark::State& state)
+{
+    transcendental(state, Simd::expKernel, std::exp, -50);
+}
+BENCHMARK(BM_Exp)->ArgsProduct({{-1, 0, 2, 3}, {1<<10, 1<<15}});
+
+/**
+ * Benchmarks the logarithm kernels. Argument 0 is the instruction-set architecture or -1 for the C
+ * math library; argument 1 is the number of values.
+ * @param[in] state  Benchmark state
+ */
+void BM_Log(benchmark::State& state)
+{
+    transcendental(state, Simd::logKernel, std::log, 1e-3);
+}
+BENCHMARK(BM_Log)->ArgsProduct({{-1, 0, 2, 3}, {1<<10, 1<<15}});
+
+}  // namespace
+
+BENCHMARK_MAIN();
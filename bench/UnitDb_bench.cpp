@@ -0,0 +1,69 @@
+/**
+ * This file benchmarks loading the database of physical quantities from its YAML definition file
+ * and from a binary snapshot of it, as a short-lived process does at startup.
+ *
+ *        File: UnitDb_bench.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AllocCounter.h"
+#include "UnitDb.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+using namespace quantity;
+
+/// Pathname of the snapshot
+const std::string snapshot{"/tmp/UnitDb_bench.bin"};
+
+/**
+ * Benchmarks loading the YAML definition file.
+ * @param[in] state  Benchmark state
+ */
+void BM_FromYaml(benchmark::State& state)
+{
+    AllocCounter counter;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(UnitDb::fromYaml(QUANTITIES_YAML));
+    counter.report(state);
+}
+BENCHMARK(BM_FromYaml);
+
+/**
+ * Benchmarks loading a snapshot of the YAML definition file.
+ * @param[in] state  Benchmark state
+ */
+void BM_FromSnapshot(benchmark::State& state)
+{
+    UnitDb::compile(QUANTITIES_YAML, snapshot);
+
+    AllocCounter counter;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(UnitDb::fromSnapshot(snapshot));
+    counter.report(state);
+
+    std::remove(snapshot.c_str());
+}
+BENCHMARK(BM_FromSnapshot);
+
+}  // namespace
+
+BENCHMARK_MAIN();
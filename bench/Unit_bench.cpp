@@ -0,0 +1,561 @@
+/**
+ * This file benchmarks the hot paths of unit algebra and conversion: obtaining a converter between
+ * every pair of unit types, converting scalars and arrays, multiplying, dividing, and
+ * exponentiating units, and multiplying dimensionalities. Each benchmark reports the number of
+ * heap allocations and allocated bytes per operation alongside its time per operation.
+ *
+ *        File: Unit_bench.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AllocCounter.h"
+#include "Arena.h"
+#include "BaseInfo.h"
+#include "Dimensionality.h"
+#include "Qvalue.h"
+#include "QvalueArray.h"
+#include "RecordConverter.h"
+#include "ThreadPool.h"
+#include "Unit.h"
+#include "UnitParser.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace quantity;
+
+/// Kinds of units. Used as benchmark arguments.
+enum Kind
+{
+    CANONICAL,
+    AFFINE,
+    REF_LOG,
+    UNREF_LOG,
+    NUM_KINDS
+};
+
+/// Names of the kinds of units
+const char* const kindNames[NUM_KINDS] = {"Canonical", "Affine", "RefLog", "UnrefLog"};
+
+/// The units used by the benchmarks. Created once because base units must have unique names.
+struct Units
+{
+    Dimensionality length;              ///< Length dimensionality
+    Dimensionality time;                ///< Time dimensionality
+    BaseInfo       meterInfo;           ///< Base unit information for the meter
+    BaseInfo       secondInfo;          ///< Base unit information for the second
+    Unit::Pimpl    meter;               ///< Base unit of length
+    Unit::Pimpl    second;              ///< Base unit of time
+    Unit::Pimpl    inputs[NUM_KINDS];   ///< Input unit of each kind
+    Unit::Pimpl    outputs[NUM_KINDS];  ///< Output unit of each kind
+
+    /// Default constructs.
+    Units()
+        : length(Dimensionality::get("Length", "L"))
+        , time(Dimensionality::get("Time", "T"))
+        , meterInfo(length, "meter", "m")
+        , secondInfo(time, "second", "s")
+        , meter(Unit::get(meterInfo))
+        , second(Unit::get(secondInfo))
+        , inputs{meter,
+                 Unit::get(meter, 3.0, 5.0),
+                 Unit::get(Unit::BaseEnum::TEN, meter),
+                 Unit::get(Unit::BaseEnum::TWO, length)}
+        , outputs{meter,
+                  Unit::get(meter, 0.3048, 0.0),
+                  Unit::get(Unit::BaseEnum::E, Unit::get(meter, 1e-3, 0.0)),
+                  Unit::get(Unit::BaseEnum::TEN, length)}
+    {}
+};
+
+/**
+ * Returns the units used by the benchmarks.
+ * @return The units used by the benchmarks
+ */
+const Units& units()
+{
+    static const Units units;
+    return units;
+}
+
+/**
+ * Returns the converter between the input and output units of the given kinds.
+ * @param[in] input     Kind of input unit
+ * @param[in] output    Kind of output unit
+ * @return              The converter
+ * @throw               std::exception  The units aren't convertible
+ */
+Converter getConverter(const int input,
+                       const int output)
+{
+    return units().inputs[input]->getConverterTo(units().outputs[output]);
+}
+
+/**
+ * Benchmarks obtaining a converter. Argument 0 is the kind of the input unit; argument 1 is the
+ * kind of the output unit.
+ * @param[in] state  Benchmark state
+ */
+void BM_GetConverterTo(benchmark::State& state)
+{
+    const auto input = static_cast<int>(state.range(0));
+    const auto output = static_cast<int>(state.range(1));
+    const auto& inUnit = units().inputs[input];
+    const auto& outUnit = units().outputs[output];
+
+    state.SetLabel(std::string(kindNames[input]) + "->" + kindNames[output]);
+    try {
+        getConverter(input, output);
+    }
+    catch (const std::exception& ex) {
+        state.SkipWithError("Units aren't convertible");
+        return;
+    }
+
+    AllocCounter counter;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(inUnit->getConverterTo(outUnit));
+    counter.report(state);
+}
+BENCHMARK(BM_GetConverterTo)->ArgsProduct({{CANONICAL, AFFINE, REF_LOG, UNREF_LOG},
+                                           {CANONICAL, AFFINE, REF_LOG, UNREF_LOG}});
+
+/**
+ * Benchmarks obtaining the backward converter between two units. Argument 0 is the kind of both
+ * units; argument 1 is non-zero if the converter is derived by Converter::inverse() rather than by
+ * Unit::getConverterTo().
+ * @param[in] state  Benchmark state
+ */
+void BM_Inverse(benchmark::State& state)
+{
+    const auto  kind = static_cast<int>(state.range(0));
+    const auto  useInverse = state.range(1) != 0;
+    const auto& inUnit = units().inputs[kind];
+    const auto& outUnit = units().outputs[kind];
+    const auto  forward = getConverter(kind, kind);
+
+    state.SetLabel(std::string(kindNames[kind]) + (useInverse ? " inverse" : " getConverterTo"));
+    AllocCounter counter;
+    if (useInverse) {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(forward.inverse());
+    }
+    else {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(outUnit->getConverterTo(inUnit));
+    }
+    counter.report(state);
+}
+BENCHMARK(BM_Inverse)->ArgsProduct({{CANONICAL, AFFINE, REF_LOG, UNREF_LOG}, {0, 1}});
+
+/**
+ * Benchmarks failing to obtain a converter between inconvertible units. Argument 0 is non-zero if
+ * Unit::tryGetConverter() is used rather than catching the exception of Unit::getConverter().
+ * @param[in] state  Benchmark state
+ */
+void BM_Inconvertible(benchmark::State& state)
+{
+    const auto  useTry = state.range(0) != 0;
+    const auto& meter = units().meter;
+    const auto& second = units().second;
+
+    state.SetLabel(useTry ? "tryGetConverter" : "exception");
+    AllocCounter counter;
+    if (useTry) {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(Unit::tryGetConverter(meter, second));
+    }
+    else {
+        for (auto _ : state) {
+            try {
+                benchmark::DoNotOptimize(Unit::getConverter(meter, second));
+            }
+            catch (const std::exception& ex) {
+                benchmark::DoNotOptimize(&ex);
+            }
+        }
+    }
+    counter.report(state);
+}
+BENCHMARK(BM_Inconvertible)->Arg(0)->Arg(1);
+
+/**
+ * Benchmarks converting one value at a time. Argument 0 is the kind of both units.
+ * @param[in] state  Benchmark state
+ */
+void BM_ConvertScalar(benchmark::State& state)
+{
+    const auto kind = static_cast<int>(state.range(0));
+    const auto conv = getConverter(kind, kind);
+    double     value = 1.5;
+
+    state.SetLabel(kindNames[kind]);
+    AllocCounter counter;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        benchmark::DoNotOptimize(conv(value));
+    }
+    counter.report(state);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConvertScalar)->DenseRange(CANONICAL, UNREF_LOG);
+
+/**
+ * Benchmarks converting arrays. Argument 0 is the kind of both units; argument 1 is the number of
+ * values.
+ * @param[in] state  Benchmark state
+ */
+void BM_ConvertArray(benchmark::State& state)
+{
+    const auto kind = static_cast<int>(state.range(0));
+    const auto n = static_cast<size_t>(state.range(1));
+    const auto conv = getConverter(kind, kind);
+    std::vector<double> in(n, 1.5);
+    std::vector<double> out(n);
+
+    state.SetLabel(kindNames[kind]);
+    AllocCounter counter;
+    for (auto _ : state) {
+        conv.convert(in.data(), out.data(), n);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    counter.report(state);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*n);
+}
+BENCHMARK(BM_ConvertArray)->ArgsProduct({{CANONICAL, AFFINE, REF_LOG, UNREF_LOG},
+                                         {1 << 10, 1 << 16}});
+
+/**
+ * Benchmarks converting two fields of an array of four-field records. Argument 0 is non-zero if a
+ * RecordConverter is used rather than de-interleaving each field into a temporary array; argument 1
+ * is the number of records.
+ * @param[in] state  Benchmark state
+ */
+void BM_ConvertRecords(benchmark::State& state)
+{
+    const auto          useRecord = state.range(0) != 0;
+    const auto          n = static_cast<size_t>(state.range(1));
+    const auto          conv = getConverter(AFFINE, AFFINE);
+    const size_t        fields[] = {2, 3};
+    std::vector<double> records(4*n, 1.5);
+    std::vector<double> column(n);
+    RecordConverter     recordConverter(4*sizeof(double));
+    for (const auto field : fields)
+        recordConverter.add(field*sizeof(double), conv);
+
+    state.SetLabel(useRecord ? "RecordConverter" : "de-interleave");
+    AllocCounter counter;
+    for (auto _ : state) {
+        if (useRecord) {
+            recordConverter.convert(records.data(), n);
+        }
+        else {
+            for (const auto field : fields) {
+                for (size_t i = 0; i < n; ++i)
+                    column[i] = records[4*i + field];
+                conv.convert(column.data(), n);
+                for (size_t i = 0; i < n; ++i)
+                    records[4*i + field] = column[i];
+            }
+        }
+        benchmark::DoNotOptimize(records.data());
+        benchmark::ClobberMemory();
+    }
+    counter.report(state);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*n);
+}
+BENCHMARK(BM_ConvertRecords)->ArgsProduct({{0, 1}, {1 << 10, 1 << 20}});
+
+/**
+ * Benchmarks converting an array between reference-logarithmic and linear units serially and in
+ * parallel. Argument 0 is whether to convert in parallel; argument 1 is the number of values.
+ * @param[in] state  Benchmark state
+ */
+void BM_ConvertParallel(benchmark::State& state)
+{
+    const auto          parallel = state.range(0) != 0;
+    const auto          n = static_cast<size_t>(state.range(1));
+    const auto          conv = getConverter(REF_LOG, CANONICAL);
+    std::vector<double> in(n, 1.5);
+    std::vector<double> out(n);
+    auto&               pool = ThreadPool::getInstance(); // Created outside the timing loop
+
+    state.SetLabel(parallel
+            ? "parallel, " + std::to_string(pool.size() + 1) + " threads"
+            : "serial");
+    for (auto _ : state) {
+        if (parallel) {
+            conv.parallelConvert(in.data(), out.data(), n, pool);
+        }
+        else {
+            conv.convert(in.data(), out.data(), n);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*n);
+}
+BENCHMARK(BM_ConvertParallel)->ArgsProduct({{0, 1}, {1 << 16, 1 << 24}});
+
+/// Ways of converting single-precision arrays. Used as benchmark arguments.
+enum FloatPath
+{
+    WIDEN_NARROW,   ///< Widen to a double array, convert it, and narrow the result
+    SINGLE,         ///< Convert with single-precision arithmetic
+    MIXED,          ///< Convert with double-precision arithmetic
+    WIDENING,       ///< Convert to a double array
+    NUM_FLOAT_PATHS
+};
+
+/// Names of the ways of converting single-precision arrays
+const char* const floatPathNames[NUM_FLOAT_PATHS] = {"widen+narrow", "float", "mixed",
+        "float->double"};
+
+/**
+ * Benchmarks converting single-precision arrays between affine units. Argument 0 is the way of
+ * converting; argument 1 is the number of values.
+ * @param[in] state  Benchmark state
+ */
+void BM_ConvertFloat(benchmark::State& state)
+{
+    const auto path = static_cast<int>(state.range(0));
+    const auto n = static_cast<size_t>(state.range(1));
+    const auto conv = getConverter(AFFINE, AFFINE);
+    const auto mixed = conv.withFloatPrecision(Converter::FloatPrecision::DOUBLE);
+    std::vector<float>  in(n, 1.5f);
+    std::vector<float>  out(n);
+    std::vector<double> wide(n);
+
+    state.SetLabel(floatPathNames[path]);
+    AllocCounter counter;
+    for (auto _ : state) {
+        switch (path) {
+            case WIDEN_NARROW:
+                std::copy(in.begin(), in.end(), wide.begin());
+                conv.convert(wide.data(), n);
+                std::copy(wide.begin(), wide.end(), out.begin());
+                break;
+            case SINGLE:   conv.convert(in.data(), out.data(), n); break;
+            case MIXED:    mixed.convert(in.data(), out.data(), n); break;
+            default:       conv.convert(in.data(), wide.data(), n);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::DoNotOptimize(wide.data());
+        benchmark::ClobberMemory();
+    }
+    counter.report(state);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*n);
+}
+BENCHMARK(BM_ConvertFloat)->ArgsProduct({{WIDEN_NARROW, SINGLE, MIXED, WIDENING},
+                                         {1 << 10, 1 << 20}});
+
+/**
+ * Benchmarks multiplying canonical units.
+ * @param[in] state  Benchmark state
+ */
+void BM_Multiply(benchmark::State& state)
+{
+    const auto& meter = units().meter;
+    const auto& second = units().second;
+
+    AllocCounter counter;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(meter->multiply(second));
+    counter.report(state);
+}
+BENCHMARK(BM_Multiply);
+
+/**
+ * Benchmarks dividing canonical units.
+ * @param[in] state  Benchmark state
+ */
+void BM_DivideBy(benchmark::State& state)
+{
+    const auto& meter = units().meter;
+    const auto& second = units().second;
+
+    AllocCounter counter;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(meter->divideBy(second));
+    counter.report(state);
+}
+BENCHMARK(BM_DivideBy);
+
+/**
+ * Benchmarks exponentiating a canonical unit.
+ * @param[in] state  Benchmark state
+ */
+void BM_Pow(benchmark::State& state)
+{
+    const auto  speed = units().meter->divideBy(units().second);
+    const auto  exp = Exponent(2);
+
+    AllocCounter counter;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(speed->pow(exp));
+    counter.report(state);
+}
+BENCHMARK(BM_Pow);
+
+/**
+ * Benchmarks evaluating a unit expression with transient intermediate units. Argument 0 is
+ * non-zero if the evaluation is done in an arena scope.
+ * @param[in] state  Benchmark state
+ */
+void BM_Expression(benchmark::State& state)
+{
+    const auto& meter = units().meter;
+    const auto& second = units().second;
+    const auto  useArena = state.range(0) != 0;
+    const auto  evaluate = [&] {
+        auto power = meter->pow(2)->multiply(meter)->divideBy(second->pow(3));
+        benchmark::DoNotOptimize(power->pow(2)->divideBy(power));
+    };
+
+    state.SetLabel(useArena ? "arena" : "heap");
+    AllocCounter counter;
+    if (useArena) {
+        for (auto _ : state) {
+            Arena::Scope scope;
+            evaluate();
+        }
+    }
+    else {
+        for (auto _ : state)
+            evaluate();
+    }
+    counter.report(state);
+}
+BENCHMARK(BM_Expression)->Arg(0)->Arg(1);
+
+/**
+ * Benchmarks parsing a unit specification. Argument 0 is non-zero if the result is cached.
+ * @param[in] state  Benchmark state
+ */
+void BM_Parse(benchmark::State& state)
+{
+    const auto  cached = state.range(0) != 0;
+    UnitParser  parser;
+    parser.define(units().meterInfo);
+    parser.define(units().secondInfo);
+    parser.define("L", units().length);
+    const std::string specs[] = {"m·s^-2", "lg(re 0.5 m·s^-1)", "2 m + 1", "lb(L^0)"};
+
+    state.SetLabel(cached ? "cached" : "uncached");
+    AllocCounter counter;
+    for (auto _ : state) {
+        for (const auto& spec : specs)
+            benchmark::DoNotOptimize(parser.parse(spec));
+        if (!cached) {
+            state.PauseTiming();
+            parser.clear();
+            state.ResumeTiming();
+        }
+    }
+    counter.report(state);
+    state.SetItemsProcessed(state.iterations()*4);
+}
+BENCHMARK(BM_Parse)->Arg(0)->Arg(1);
+
+/**
+ * Benchmarks multiplying dimensionalities.
+ * @param[in] state  Benchmark state
+ */
+void BM_DimensionalityMultiply(benchmark::State& state)
+{
+    const auto& length = units().length;
+    const auto  speed = length.divideBy(units().time);
+
+    AllocCounter counter;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(length.multiply(speed));
+    counter.report(state);
+}
+BENCHMARK(BM_DimensionalityMultiply);
+
+/**
+ * Benchmarks adding values with units. Argument 0 is non-zero if the units differ, in which case
+ * the addend must be converted.
+ * @param[in] state  Benchmark state
+ */
+void BM_QvalueAdd(benchmark::State& state)
+{
+    const auto   sameUnit = state.range(0) == 0;
+    const Qvalue x{1, units().meter};
+    const Qvalue y{2, sameUnit ? units().meter : units().outputs[AFFINE]};
+
+    state.SetLabel(sameUnit ? "same unit" : "different units");
+    AllocCounter counter;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(x + y);
+    counter.report(state);
+}
+BENCHMARK(BM_QvalueAdd)->Arg(0)->Arg(1);
+
+/**
+ * Benchmarks evaluating `x0 + v0*t` over arrays. Argument 0 is how: 0 by a loop over plain
+ * numbers, 1 by one fused expression, or 2 by two expressions with an intermediate array; argument
+ * 1 is the number of elements.
+ * @param[in] state  Benchmark state
+ */
+void BM_QvalueExpr(benchmark::State& state)
+{
+    const auto        how = state.range(0);
+    const auto        n = static_cast<size_t>(state.range(1));
+    const auto&       meter = units().meter;
+    const auto        speed = meter->divideBy(units().second);
+    const QvalueArray x0{meter, n, 1};
+    const QvalueArray v0{speed, n, 5};
+    const Qvalue      t{2, units().second};
+    QvalueArray       x{meter, n};
+
+    static const char* const labels[] = {"plain", "fused", "intermediate"};
+    state.SetLabel(labels[how]);
+    AllocCounter counter;
+    for (auto _ : state) {
+        if (how == 0) {
+            const auto in0 = x0.data();
+            const auto in1 = v0.data();
+            const auto dt = t.getValue();
+            auto       out = x.data();
+            for (size_t i = 0; i < n; ++i)
+                out[i] = in0[i] + in1[i]*dt;
+        }
+        else if (how == 1) {
+            x = x0 + v0*t;
+        }
+        else {
+            const QvalueArray dx = v0*t;
+            x = x0 + dx;
+        }
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    counter.report(state);
+    state.SetItemsProcessed(state.iterations()*n);
+}
+BENCHMARK(BM_QvalueExpr)->ArgsProduct({{0, 1, 2}, {1 << 10, 1 << 16}});
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -23,58 +23,12 @@
 #include "AffineUnit.h"
 #include "CanonicalUnit.h"
 #include "Converter.h"
-#include "ConverterImpl.h"
+#include "ConverterIr.h"
 #include "RefLogUnit.h"
 #include "UnrefLogUnit.h"
 
 namespace quantity {
 
-/// Converter of numeric values in an affine unit to an output unit.
-class AffineUnit::ToConverter : public ConverterImpl {
-private:
-    const Converter coreConverter;
-    const double    slope;
-    const double    intercept;
-public:
-    /**
-     * Move constructs.
-     * @param[in] coreConverter     The core unit's converter to the output unit
-     * @param[in] slope             The affine unit's slope parameter
-     * @param[in] intercept         The affine unit's intercept parameter
-     */
-    ToConverter(const Converter&& coreConverter, const double slope, const double intercept)
-        : coreConverter(coreConverter)
-        , slope(slope)
-        , intercept(intercept)
-    {}
-    double operator()(const double value) const override {
-        return coreConverter((value - intercept)/slope);
-    }
-};
-
-/// Converter of numeric values in an input unit to an affine unit.
-class AffineUnit::FromConverter : public ConverterImpl {
-private:
-    const Converter coreConverter;
-    const double    slope;
-    const double    intercept;
-public:
-    /**
-     * Move constructs.
-     * @param[in] coreConverter     The core unit's converter from the input unit
-     * @param[in] slope             The affine unit's slope parameter
-     * @param[in] intercept         The affine unit's intercept parameter
-     */
-    FromConverter(const Converter&& coreConverter, const double slope, const double intercept)
-        : coreConverter(coreConverter)
-        , slope(slope)
-        , intercept(intercept)
-    {}
-    double operator()(const double value) const override {
-        return slope*coreConverter(value) + intercept;
-    }
-};
-
 AffineUnit::AffineUnit(
         const Pimpl&      core,
         const double      slope,
@@ -89,6 +43,16 @@ AffineUnit::AffineUnit(
         throw std::invalid_argument("Slope is one and intercept is zero");
 }
 
+Converter AffineUnit::toConverter(Converter&& coreConverter) const
+{
+    return ConverterIr().linear(intercept, 1/slope).append(coreConverter).compile();
+}
+
+Converter AffineUnit::fromConverter(Converter&& coreConverter) const
+{
+    return ConverterIr().append(coreConverter).linear(0, slope, intercept).compile();
+}
+
 std::string AffineUnit::to_string() const
 {
     string rep{""};
@@ -143,6 +107,8 @@ size_t AffineUnit::hash() const
 
 int AffineUnit::compare(const Pimpl& other) const
 {
+    if (other.get() == this)
+        return 0;
     return -other->compareTo(*this);
 }
 
@@ -180,27 +146,29 @@ int AffineUnit::compareTo(const UnrefLogUnit& other) const
     return -1;  // Affine units come before log units
 }
 
-bool AffineUnit::isConvertible(const Pimpl& other) const
+bool AffineUnit::isConvertible(const Pimpl& other) const noexcept
 {
+    if (other.get() == this)
+        return true;
     return other->isConvertibleTo(*this);
 }
 
-bool AffineUnit::isConvertibleTo(const CanonicalUnit& other) const
+bool AffineUnit::isConvertibleTo(const CanonicalUnit& other) const noexcept
 {
     return core->isConvertibleTo(other);
 }
 
-bool AffineUnit::isConvertibleTo(const AffineUnit& other) const
+bool AffineUnit::isConvertibleTo(const AffineUnit& other) const noexcept
 {
     return core->isConvertible(other.core);
 }
 
-bool AffineUnit::isConvertibleTo(const RefLogUnit& other) const
+bool AffineUnit::isConvertibleTo(const RefLogUnit& other) const noexcept
 {
     return other.isConvertibleTo(*this); // Defer to the other unit
 }
 
-bool AffineUnit::isConvertibleTo(const UnrefLogUnit& other) const
+bool AffineUnit::isConvertibleTo(const UnrefLogUnit& other) const noexcept
 {
     return other.isConvertibleTo(*this); // Defer to the other unit
 }
@@ -210,7 +178,7 @@ Converter AffineUnit::getConverterTo(const Pimpl& output) const
     if (!isConvertible(output))
         throw invalid_argument("Units are not convertible");
 
-    return Converter(new ToConverter(core->getConverterTo(output), slope, intercept));
+    return toConverter(core->getConverterTo(output));
 }
 
 Converter AffineUnit::getConverterFrom(const CanonicalUnit& input) const
@@ -218,7 +186,7 @@ Converter AffineUnit::getConverterFrom(const CanonicalUnit& input) const
     if (!isConvertibleTo(input))
         throw invalid_argument("Units are not convertible");
 
-    return Converter(new FromConverter(core->getConverterFrom(input), slope, intercept));
+    return fromConverter(core->getConverterFrom(input));
 }
 
 Converter AffineUnit::getConverterFrom(const AffineUnit& input) const
@@ -226,7 +194,7 @@ Converter AffineUnit::getConverterFrom(const AffineUnit& input) const
     if (!isConvertibleTo(input))
         throw invalid_argument("Units are not convertible");
 
-    return Converter(new FromConverter(core->getConverterFrom(input), slope, intercept));
+    return fromConverter(core->getConverterFrom(input));
 }
 
 Converter AffineUnit::getConverterFrom(const RefLogUnit& input) const
@@ -234,7 +202,7 @@ Converter AffineUnit::getConverterFrom(const RefLogUnit& input) const
     if (!isConvertibleTo(input))
         throw invalid_argument("Units are not convertible");
 
-    return Converter(new FromConverter(core->getConverterFrom(input), slope, intercept));
+    return fromConverter(core->getConverterFrom(input));
 }
 
 Converter AffineUnit::getConverterFrom(const UnrefLogUnit& input) const
@@ -242,7 +210,7 @@ Converter AffineUnit::getConverterFrom(const UnrefLogUnit& input) const
     if (!isConvertibleTo(input))
         throw invalid_argument("Units are not convertible");
 
-    return Converter(new FromConverter(core->getConverterFrom(input), slope, intercept));
+    return fromConverter(core->getConverterFrom(input));
 }
 
 Unit::Pimpl AffineUnit::multiply(const Pimpl& other) const
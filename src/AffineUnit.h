@@ -25,6 +25,7 @@
 #pragma once
 
 #include "Unit.h"
+#include "AllocStats.h"
 #include "Converter.h"
 
 namespace quantity {
@@ -34,16 +35,32 @@ namespace quantity {
  * intercept == 0) will always be false.
  */
 class AffineUnit final : public Unit
+                       , public AllocCounted<AllocStats::Class::AFFINE_UNIT>
 {
     const Pimpl     core;        ///< The underlying unit
     const double    slope;       ///< The slope for converting a numeric value from the @ core unit.
                                  ///< May be one but only if the intercept isn't zero.
     const double    intercept;   ///< The intercept for converting a numeric value from the @ core
 
-public:
-    class ToConverter;      ///< Converter of numeric values in this affine unit to an output unit.
-    class FromConverter;    ///< Converter of numeric values in an input unit to this affine unit.
+    /**
+     * Returns a converter of numeric values in this unit to an output unit. The conversion is
+     * simplified by ConverterIr, so it's a single linear converter if the core unit's converter is
+     * linear.
+     * @param[in] coreConverter     Converter of numeric values in the core unit to the output unit
+     * @return                      Converter of numeric values in this unit to the output unit
+     */
+    Converter toConverter(Converter&& coreConverter) const;
 
+    /**
+     * Returns a converter of numeric values in an input unit to this unit. The conversion is
+     * simplified by ConverterIr, so it's a single linear converter if the core unit's converter is
+     * linear.
+     * @param[in] coreConverter     Converter of numeric values in the input unit to the core unit
+     * @return                      Converter of numeric values in the input unit to this unit
+     */
+    Converter fromConverter(Converter&& coreConverter) const;
+
+public:
     /**
      * Constructs
      * @param[in] core                      The underlying unit from which this unit is derived
@@ -135,7 +152,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertible(const Pimpl& other) const override;
+    bool isConvertible(const Pimpl& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with a derived unit.
@@ -143,7 +160,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const CanonicalUnit& other) const override;
+    bool isConvertibleTo(const CanonicalUnit& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with an affine unit.
@@ -151,7 +168,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const AffineUnit& other) const override;
+    bool isConvertibleTo(const AffineUnit& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with a referenced logarithmic unit.
@@ -159,7 +176,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const RefLogUnit& other) const override;
+    bool isConvertibleTo(const RefLogUnit& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with an unreferenced logarithmic
@@ -168,7 +185,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const UnrefLogUnit& other) const override;
+    bool isConvertibleTo(const UnrefLogUnit& other) const noexcept override;
 
     /**
      * Returns a converter of numeric values to an output unit.
@@ -0,0 +1,96 @@
+/**
+ * This file implements optional counting of the heap allocations made by the library.
+ *
+ *        File: AllocStats.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AllocStats.h"
+
+namespace quantity {
+
+/// Number of counted classes
+static constexpr size_t numClasses = static_cast<size_t>(AllocStats::Class::COUNT);
+
+#ifdef QUANTITY_ALLOC_STATS
+/// Allocation counts of the current thread indexed by class
+static thread_local AllocStats::Counts counts[numClasses];
+#endif
+
+AllocStats::Counts AllocStats::get(const Class cls) noexcept
+{
+#ifdef QUANTITY_ALLOC_STATS
+    return counts[static_cast<size_t>(cls)];
+#else
+    return Counts{0, 0, 0};
+#endif
+}
+
+AllocStats::Counts AllocStats::getTotal() noexcept
+{
+    Counts total{0, 0, 0};
+    for (size_t i = 0; i < numClasses; ++i) {
+        const auto classCounts = get(static_cast<Class>(i));
+        total.allocs += classCounts.allocs;
+        total.bytes += classCounts.bytes;
+        total.frees += classCounts.frees;
+    }
+    return total;
+}
+
+void AllocStats::reset() noexcept
+{
+#ifdef QUANTITY_ALLOC_STATS
+    for (auto& classCounts : counts)
+        classCounts = Counts{0, 0, 0};
+#endif
+}
+
+const char* AllocStats::to_string(const Class cls) noexcept
+{
+    static const char* const names[numClasses] = {
+        "BaseInfoImpl",
+        "CanonicalUnit",
+        "AffineUnit",
+        "RefLogUnit",
+        "UnrefLogUnit",
+        "ConverterImpl",
+        "DimensionalityImpl"
+    };
+    const auto i = static_cast<size_t>(cls);
+    return i < numClasses ? names[i] : "Unknown";
+}
+
+void AllocStats::recordAlloc(const Class  cls,
+                             const size_t size) noexcept
+{
+#ifdef QUANTITY_ALLOC_STATS
+    auto& classCounts = counts[static_cast<size_t>(cls)];
+    ++classCounts.allocs;
+    classCounts.bytes += size;
+#endif
+}
+
+void AllocStats::recordFree(const Class cls) noexcept
+{
+#ifdef QUANTITY_ALLOC_STATS
+    ++counts[static_cast<size_t>(cls)].frees;
+#endif
+}
+
+} // namespace quantity
@@ -0,0 +1,152 @@
+/**
+ * This file declares optional counting of the heap allocations made by the library.
+ *
+ *        File: AllocStats.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace quantity {
+
+/**
+ * Per-thread counts of the heap allocations of the library's classes. Counting is enabled by
+ * defining the preprocessor macro QUANTITY_ALLOC_STATS when building the library (e.g., by
+ * configuring with "cmake -DQUANTITY_ALLOC_STATS=ON ..."). If it's not defined, then no counting
+ * code is compiled and every count is zero.
+ *
+ * Only the objects allocated by `new` are counted: the control blocks of `std::shared_ptr` and the
+ * storage of standard containers aren't.
+ * @threadsafety    Safe. Each thread has its own counts.
+ */
+class AllocStats final
+{
+public:
+    /// The classes whose allocations are counted
+    enum class Class
+    {
+        BASE_INFO,          ///< Implementation of base unit information
+        CANONICAL_UNIT,     ///< Canonical unit
+        AFFINE_UNIT,        ///< Affine unit
+        REF_LOG_UNIT,       ///< Referenced logarithmic unit
+        UNREF_LOG_UNIT,     ///< Unreferenced logarithmic unit
+        CONVERTER,          ///< Converter implementation
+        DIMENSIONALITY,     ///< Implementation of dimensionality
+        COUNT               ///< Number of classes. Must be last.
+    };
+
+    /// Allocation counts of a class
+    struct Counts
+    {
+        uint64_t allocs;    ///< Number of allocations
+        uint64_t bytes;     ///< Number of allocated bytes
+        uint64_t frees;     ///< Number of deallocations
+    };
+
+    /**
+     * Indicates if allocations are counted.
+     * @retval true     Allocations are counted
+     * @retval false    Allocations aren't counted
+     */
+    static constexpr bool isEnabled() noexcept
+    {
+#ifdef QUANTITY_ALLOC_STATS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Returns the allocation counts of a class for the current thread.
+     * @param[in] cls   The class
+     * @return          The allocation counts of the class since the thread started or was reset.
+     *                  All zero if allocations aren't counted.
+     */
+    static Counts get(const Class cls) noexcept;
+
+    /**
+     * Returns the allocation counts of all classes for the current thread.
+     * @return  The sum of the allocation counts of all classes
+     */
+    static Counts getTotal() noexcept;
+
+    /// Zeros the allocation counts of the current thread.
+    static void reset() noexcept;
+
+    /**
+     * Returns the name of a class.
+     * @param[in] cls   The class
+     * @return          The name of the class (e.g., "CanonicalUnit")
+     */
+    static const char* to_string(const Class cls) noexcept;
+
+    /**
+     * Records an allocation by the current thread.
+     * @param[in] cls   The class of the allocated object
+     * @param[in] size  The number of allocated bytes
+     */
+    static void recordAlloc(const Class  cls,
+                            const size_t size) noexcept;
+
+    /**
+     * Records a deallocation by the current thread.
+     * @param[in] cls   The class of the deallocated object
+     */
+    static void recordFree(const Class cls) noexcept;
+};
+
+/**
+ * Base class that counts the heap allocations of a derived class. Empty, and without effect, if
+ * allocations aren't counted.
+ * @tparam CLS  The class of the derived class
+ */
+template<AllocStats::Class CLS>
+class AllocCounted
+{
+#ifdef QUANTITY_ALLOC_STATS
+public:
+    /**
+     * Allocates an object.
+     * @param[in] size  The size of the object in bytes
+     * @return          Storage for the object
+     * @throw std::bad_alloc    Out of memory
+     */
+    static void* operator new(const size_t size)
+    {
+        auto ptr = ::operator new(size);
+        AllocStats::recordAlloc(CLS, size);
+        return ptr;
+    }
+
+    /**
+     * Deallocates an object.
+     * @param[in] ptr   Storage of the object
+     */
+    static void operator delete(void* const ptr) noexcept
+    {
+        AllocStats::recordFree(CLS);
+        ::operator delete(ptr);
+    }
+#endif
+};
+
+} // namespace quantity
@@ -0,0 +1,175 @@
+/**
+ * This file implements an arena for the transient objects of unit expressions.
+ *
+ *        File: Arena.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Arena.h"
+
+#include <atomic>
+#include <new>
+
+using namespace std;
+
+namespace quantity {
+
+/**
+ * Size of the header that precedes every allocation. It holds a pointer to the allocation's block
+ * (nullptr for an individual heap allocation) and preserves the alignment of the allocation.
+ */
+static constexpr size_t headerSize = alignof(max_align_t);
+
+static_assert(headerSize >= sizeof(void*), "Allocation header can't hold a pointer");
+
+/**
+ * Rounds a size up to a multiple of the header size.
+ * @param[in] size  The size
+ * @return          The rounded size
+ */
+static constexpr size_t roundUp(const size_t size)
+{
+    return (size + headerSize - 1)/headerSize*headerSize;
+}
+
+/// The innermost arena scope of the current thread or nullptr
+static thread_local Arena::Scope* currentScope = nullptr;
+
+/**
+ * A block of storage from which allocations are carved. The block is returned to the heap when
+ * its reference count, which is one for the scope allocating from it plus one for each live
+ * allocation, becomes zero.
+ */
+struct Arena::Block
+{
+    atomic<size_t> refs;    ///< Reference count
+    char*          next;    ///< Start of unallocated storage
+    char*          end;     ///< End of the block
+
+    /**
+     * Creates a block that's referenced by its creator.
+     * @param[in] size  Number of bytes available for allocations
+     * @return          The block
+     * @throw std::bad_alloc    Out of memory
+     */
+    static Block* create(const size_t size)
+    {
+        const auto start = static_cast<char*>(::operator new(roundUp(sizeof(Block)) + size));
+        auto       block = new(start) Block();
+        block->refs.store(1, memory_order_relaxed);
+        block->next = start + roundUp(sizeof(Block));
+        block->end = block->next + size;
+        return block;
+    }
+
+    /// Removes a reference. Returns the block to the heap if it was the last one.
+    void release() noexcept
+    {
+        if (refs.fetch_sub(1, memory_order_acq_rel) == 1) {
+            this->~Block();
+            ::operator delete(this);
+        }
+    }
+};
+
+Arena::Local::~Local() noexcept =default;
+
+void* Arena::Local::operator new(const size_t size)
+{
+    return Arena::allocate(size);
+}
+
+void Arena::Local::operator delete(void* const ptr) noexcept
+{
+    Arena::deallocate(ptr);
+}
+
+Arena::Scope::Scope(const size_t blockSize)
+    : prev(currentScope)
+    , block(nullptr)
+    , blockSize(roundUp(blockSize))
+    , locals(nullptr)
+{
+    currentScope = this;
+}
+
+Arena::Scope::~Scope() noexcept
+{
+    currentScope = prev;
+    while (locals) {
+        auto next = locals->next;
+        delete locals;
+        locals = next;
+    }
+    if (block)
+        block->release();
+}
+
+Arena::Scope* Arena::Scope::current() noexcept
+{
+    return currentScope;
+}
+
+void* Arena::Scope::allocate(const size_t size)
+{
+    const auto total = headerSize + roundUp(size);
+    if (total > blockSize/4)
+        return nullptr;
+
+    if (block == nullptr || static_cast<size_t>(block->end - block->next) < total) {
+        auto newBlock = Block::create(blockSize);
+        if (block)
+            block->release();
+        block = newBlock;
+    }
+
+    auto start = block->next;
+    block->next += total;
+    block->refs.fetch_add(1, memory_order_relaxed);
+    *reinterpret_cast<Block**>(start) = block;
+    return start + headerSize;
+}
+
+void* Arena::allocate(const size_t size)
+{
+    if (currentScope) {
+        if (auto ptr = currentScope->allocate(size))
+            return ptr;
+    }
+
+    auto start = static_cast<char*>(::operator new(headerSize + size));
+    *reinterpret_cast<Block**>(start) = nullptr;
+    return start + headerSize;
+}
+
+void Arena::deallocate(void* const ptr) noexcept
+{
+    if (ptr == nullptr)
+        return;
+
+    auto start = static_cast<char*>(ptr) - headerSize;
+    auto block = *reinterpret_cast<Block**>(start);
+    if (block) {
+        block->release();
+    }
+    else {
+        ::operator delete(start);
+    }
+}
+
+} // namespace quantity
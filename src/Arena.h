@@ -0,0 +1,300 @@
+/**
+ * This file declares an arena for the transient objects of unit expressions.
+ *
+ *        File: Arena.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "AllocStats.h"
+
+#include <cstddef>
+
+namespace quantity {
+
+/**
+ * Bulk allocation of the objects created while evaluating a unit expression. While an
+ * Arena::Scope exists on a thread, the canonical units and dimensionalities that the thread
+ * creates (e.g., by Unit::multiply(), Unit::divideBy(), and Unit::pow()), together with the
+ * control blocks of their shared pointers, are carved out of large blocks instead of being
+ * allocated individually. Such units are interned in a table that belongs to the scope, so the
+ * intermediate units of an expression never enter the process-wide table; those that are still
+ * referenced when the scope ends are moved to it. Freeing an arena object costs only a decrement,
+ * and a block is returned to the heap in one operation once the scope has ended and all of the
+ * block's objects have been destroyed. Objects may outlive the scope that created them (e.g., the
+ * result of an expression); they merely keep their block alive.
+ *
+ * Example:
+ *
+ *     Unit::Pimpl power;
+ *     {
+ *         Arena::Scope scope;
+ *         power = kg->multiply(m->pow(2))->divideBy(s->pow(3));
+ *     } // Intermediate units are released in bulk
+ *
+ * @threadsafety    Safe. Scopes are per-thread; objects may be destroyed on any thread.
+ */
+class Arena final
+{
+private:
+    struct Block;
+
+public:
+    class Scope;
+
+    /**
+     * Base class of objects that belong to a scope, such as a table of the units created in it.
+     * They're allocated from the scope and destroyed, most recent first, when it ends.
+     */
+    class Local
+    {
+        friend class Scope;
+
+        Local* next; ///< The next older object of the same scope or nullptr
+
+    protected:
+        /// Default constructs.
+        Local() noexcept
+            : next(nullptr)
+        {}
+
+    public:
+        Local(const Local& other) =delete;
+        Local& operator=(const Local& rhs) =delete;
+
+        /// Destroys.
+        virtual ~Local() noexcept;
+
+        /**
+         * Allocates an object from the current thread's scope.
+         * @param[in] size  The size of the object in bytes
+         * @return          Storage for the object
+         * @throw std::bad_alloc    Out of memory
+         */
+        static void* operator new(const size_t size);
+
+        /**
+         * Deallocates an object.
+         * @param[in] ptr   Storage of the object
+         */
+        static void operator delete(void* const ptr) noexcept;
+    };
+
+    /// An RAII scope in which the current thread allocates from an arena. Scopes may be nested.
+    class Scope final
+    {
+        friend class Arena;
+
+        Scope* const prev;      ///< The enclosing scope or nullptr
+        Block*       block;     ///< The block being allocated from or nullptr
+        const size_t blockSize; ///< Size of a block in bytes
+        Local*       locals;    ///< The newest object that belongs to this scope or nullptr
+
+        /**
+         * Allocates storage from this scope.
+         * @param[in] size  The number of bytes
+         * @return          The storage. Is preceded by a pointer to its block.
+         * @throw std::bad_alloc    Out of memory
+         */
+        void* allocate(const size_t size);
+
+    public:
+        /// Default size of a block in bytes
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 16384;
+
+        /**
+         * Constructs. The current thread will allocate from this scope until it's destroyed.
+         * @param[in] blockSize     Size of a block in bytes. Objects larger than a quarter of
+         *                          this are allocated individually.
+         */
+        explicit Scope(const size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+        Scope(const Scope& other) =delete;
+        Scope& operator=(const Scope& rhs) =delete;
+
+        /**
+         * Destroys. The current thread reverts to the enclosing scope, if any, and then the
+         * objects that belong to this scope are destroyed.
+         */
+        ~Scope() noexcept;
+
+        /**
+         * Returns the innermost scope of the current thread.
+         * @return The innermost scope of the current thread or nullptr if there's none
+         */
+        static Scope* current() noexcept;
+
+        /**
+         * Returns the enclosing scope.
+         * @return The enclosing scope or nullptr if there's none
+         */
+        Scope* enclosing() const noexcept
+        {
+            return prev;
+        }
+
+        /**
+         * Returns the object of a given type that belongs to this scope.
+         * @tparam T    The type of the object. Must derive from Local.
+         * @return      The object or nullptr if it doesn't exist
+         */
+        template<typename T>
+        T* find() const noexcept
+        {
+            for (auto local = locals; local; local = local->next) {
+                if (auto object = dynamic_cast<T*>(local))
+                    return object;
+            }
+            return nullptr;
+        }
+
+        /**
+         * Returns the object of a given type that belongs to this scope, creating it if necessary.
+         * @pre                     This is the innermost scope of the current thread
+         * @tparam T                The type of the object. Must derive from Local and be default
+         *                          constructible.
+         * @return                  The object
+         * @throw std::bad_alloc    Out of memory
+         */
+        template<typename T>
+        T& get()
+        {
+            auto object = find<T>();
+            if (object == nullptr) {
+                object = new T();
+                object->next = locals;
+                locals = object;
+            }
+            return *object;
+        }
+    };
+
+    /**
+     * Allocates storage from the current thread's scope or, if there's none, from the heap.
+     * @param[in] size  The number of bytes
+     * @return          The storage
+     * @throw std::bad_alloc    Out of memory
+     */
+    static void* allocate(const size_t size);
+
+    /**
+     * Deallocates storage returned by allocate().
+     * @param[in] ptr   The storage. May be nullptr.
+     */
+    static void deallocate(void* const ptr) noexcept;
+};
+
+/**
+ * An allocator that allocates from the current thread's arena scope, if any, and otherwise from the
+ * heap. Used for the control blocks of the shared pointers to arena objects and for the nodes of
+ * containers that belong to a scope.
+ * @tparam T    The type of the allocated objects
+ */
+template<typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T; ///< Type of the allocated objects
+
+    /// Default constructs.
+    ArenaAllocator() noexcept =default;
+
+    /**
+     * Constructs from an allocator of another type.
+     * @param[in] other The other allocator
+     */
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+    {}
+
+    /**
+     * Allocates storage.
+     * @param[in] n     The number of objects
+     * @return          Storage for the objects
+     * @throw std::bad_alloc    Out of memory
+     */
+    T* allocate(const size_t n)
+    {
+        return static_cast<T*>(Arena::allocate(n*sizeof(T)));
+    }
+
+    /**
+     * Deallocates storage.
+     * @param[in] ptr   Storage returned by allocate()
+     * @param[in] n     The number of objects
+     */
+    void deallocate(T* const ptr, const size_t n) noexcept
+    {
+        Arena::deallocate(ptr);
+    }
+};
+
+/// Arena allocators are interchangeable.
+template<typename T, typename U>
+inline bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+{
+    return true;
+}
+
+/// Arena allocators are interchangeable.
+template<typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+{
+    return false;
+}
+
+/**
+ * Base class that allocates a derived class from the current thread's arena scope, if any, and
+ * counts its heap allocations if allocations are counted.
+ * @tparam CLS  The class of the derived class
+ * @see AllocCounted
+ */
+template<AllocStats::Class CLS>
+class ArenaAllocated
+{
+public:
+    /**
+     * Allocates an object.
+     * @param[in] size  The size of the object in bytes
+     * @return          Storage for the object
+     * @throw std::bad_alloc    Out of memory
+     */
+    static void* operator new(const size_t size)
+    {
+        auto ptr = Arena::allocate(size);
+#ifdef QUANTITY_ALLOC_STATS
+        AllocStats::recordAlloc(CLS, size);
+#endif
+        return ptr;
+    }
+
+    /**
+     * Deallocates an object.
+     * @param[in] ptr   Storage of the object
+     */
+    static void operator delete(void* const ptr) noexcept
+    {
+#ifdef QUANTITY_ALLOC_STATS
+        AllocStats::recordFree(CLS);
+#endif
+        Arena::deallocate(ptr);
+    }
+};
+
+} // namespace quantity
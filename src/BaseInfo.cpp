@@ -21,10 +21,12 @@
  */
 
 #include "BaseInfo.h"
+#include "AllocStats.h"
 #include "Dimensionality.h"
 
 #include "Unit.h"
 
+#include <mutex>
 #include <unordered_set>
 
 using namespace std;
@@ -32,15 +34,32 @@ using namespace std;
 namespace quantity {
 
 /// Implementation of a base unit. NB: Not an actual unit: just an information holder.
-class BaseInfoImpl final
+class BaseInfoImpl final : public AllocCounted<AllocStats::Class::BASE_INFO>
 {
 private:
     const Dimensionality dim;        ///< Associated physical dimension
     const string         name;       ///< Base unit name
     const string         symbol;     ///< Base unit symbol
 
-    static unordered_set<string>    nameSet;    ///< Set of extant base unit names
-    static unordered_set<string>    symSet;     ///< Set of extant base unit symbols
+    /**
+     * Names and symbols of extant base units. It's only modified (by construction and destruction),
+     * never just read, so a mutex suffices.
+     */
+    struct Registry {
+        mutex                 lock;     ///< Protects the sets
+        unordered_set<string> nameSet;  ///< Set of extant base unit names
+        unordered_set<string> symSet;   ///< Set of extant base unit symbols
+    };
+
+    /**
+     * Returns the registry of extant base units.
+     * @return The registry of extant base units
+     */
+    static Registry& registry()
+    {
+        static Registry instance;
+        return instance;
+    }
 
 public:
     /// Default constructs.
@@ -68,20 +87,30 @@ public:
         if (symbol.size() == 0)
             throw std::invalid_argument("No symbol for base unit");
 
-        if (nameSet.count(name))
+        auto&             reg = registry();
+        lock_guard<mutex> guard{reg.lock};
+        if (reg.nameSet.count(name))
             throw std::invalid_argument("Base unit \"" + name + "\" already exists");
-        if (symSet.count(symbol))
+        if (reg.symSet.count(symbol))
             throw std::invalid_argument("Base unit \"" + symbol + "\" already exists");
 
-        nameSet.insert(name);
-        symSet.insert(symbol);
+        reg.nameSet.insert(name);
+        try {
+            reg.symSet.insert(symbol);
+        }
+        catch (...) {
+            reg.nameSet.erase(name);
+            throw;
+        }
     }
 
     /// Destroys.
     ~BaseInfoImpl() noexcept
     {
-        nameSet.erase(name);
-        symSet.erase(symbol);
+        auto&             reg = registry();
+        lock_guard<mutex> guard{reg.lock};
+        reg.nameSet.erase(name);
+        reg.symSet.erase(symbol);
     }
 
     /**
@@ -115,9 +144,6 @@ public:
     }
 };
 
-unordered_set<string>    BaseInfoImpl::nameSet;    ///< Set of extant base unit names
-unordered_set<string>    BaseInfoImpl::symSet;     ///< Set of extant base unit symbols
-
 BaseInfo::BaseInfo(const Dimensionality& dim,
                    const string&         name,
                    const string&         symbol)
@@ -136,6 +162,8 @@ size_t BaseInfo::hash() const
 
 int BaseInfo::compare(const BaseInfo& other) const
 {
+    if (pImpl == other.pImpl)
+        return 0;   // Extant base units have unique symbols
     return pImpl->compare(*other.pImpl);
 }
 
@@ -23,36 +23,24 @@
 
 #include "AffineUnit.h"
 #include "BaseInfo.h"
-#include "ConverterImpl.h"
 #include "Exponent.h"
+#include "LinearConverter.h"
 #include "RefLogUnit.h"
 #include "UnrefLogUnit.h"
 
 namespace quantity {
 
-/// A unit value converter that returns the same value.
-class TrivialConverter final : public ConverterImpl
-{
-public:
-    /**
-     * Converts a numeric value in the input unit to the equivalent value in the output unit.
-     * @param[in] value     Numeric value in the input unit
-     * @return              Equivalent value in the output unit
-     */
-    double operator()(const double value) const override
-    {
-        return value;
-    }
-};
-
-CanonicalUnit::CanonicalUnit(const UnitFactors& otherFactors)
-    : factors(otherFactors)
+CanonicalUnit::CanonicalUnit(UnitFactors&& otherFactors)
+    : factors(std::move(otherFactors))
 {}
 
 CanonicalUnit::CanonicalUnit(const BaseInfo& baseInfo,
                              Exponent        exp)
-    : factors{UnitFactor(baseInfo, exp)}
-{}
+    : factors()
+{
+    if (!exp.isZero())
+        factors.emplace_back(baseInfo, exp);
+}
 
 CanonicalUnit::CanonicalUnit(const BaseInfo& baseInfo)
     : CanonicalUnit(baseInfo, Exponent(1, 1))
@@ -77,7 +65,7 @@ std::string CanonicalUnit::to_string() const
 
 Unit::Type CanonicalUnit::type() const
 {
-    return (factors.size() == 1 && factors.begin()->second.isOne())
+    return (factors.size() == 1 && factors[0].second.isOne())
             ? Type::BASE
             : Type::CANONICAL;
 }
@@ -102,6 +90,8 @@ size_t CanonicalUnit::hash() const
 
 int CanonicalUnit::compare(const Pimpl& other) const
 {
+    if (other.get() == this)
+        return 0;
     return -other->compareTo(*this);
 }
 
@@ -145,38 +135,39 @@ int CanonicalUnit::compareTo(const UnrefLogUnit& other) const
     return -1;  // Canonical units come before everything else
 }
 
-bool CanonicalUnit::isConvertible(const Pimpl& other) const
+bool CanonicalUnit::isConvertible(const Pimpl& other) const noexcept
 {
+    if (other.get() == this)
+        return true;
     return other->isConvertibleTo(*this);
 }
 
-bool CanonicalUnit::isConvertibleTo(const CanonicalUnit& other) const
+bool CanonicalUnit::isConvertibleTo(const CanonicalUnit& other) const noexcept
 {
+    if (&other == this)
+        return true;
     if (factors.size() != other.factors.size())
         return false;
 
-    auto       iter1 = factors.begin();
-    auto       iter2 = other.factors.begin();
-    const auto end1 = factors.end();
-
-    for (; iter1 != end1; ++iter1, ++iter2)
-        if (iter1->first.compare(iter2->first) != 0 || iter1->second.compare(iter2->second) != 0)
+    for (size_t i = 0; i < factors.size(); ++i)
+        if (factors[i].first.compare(other.factors[i].first) != 0 ||
+                factors[i].second.compare(other.factors[i].second) != 0)
             return false;
 
     return true;
 }
 
-bool CanonicalUnit::isConvertibleTo(const AffineUnit& other) const
+bool CanonicalUnit::isConvertibleTo(const AffineUnit& other) const noexcept
 {
     return other.isConvertibleTo(*this); // Defer to the other unit
 }
 
-bool CanonicalUnit::isConvertibleTo(const RefLogUnit& other) const
+bool CanonicalUnit::isConvertibleTo(const RefLogUnit& other) const noexcept
 {
     return other.isConvertibleTo(*this); // Defer to the other unit
 }
 
-bool CanonicalUnit::isConvertibleTo(const UnrefLogUnit& other) const
+bool CanonicalUnit::isConvertibleTo(const UnrefLogUnit& other) const noexcept
 {
     return other.isConvertibleTo(*this); // Defer to the other unit
 }
@@ -191,7 +182,7 @@ Converter CanonicalUnit::getConverterFrom(const CanonicalUnit& output) const
     if (!isConvertibleTo(output))
         throw invalid_argument("Units are not convertible");
 
-    return Converter(new TrivialConverter());
+    return Converter(new LinearConverter()); // Identity transformation
 }
 
 Converter CanonicalUnit::getConverterFrom(const AffineUnit& output) const
@@ -207,8 +198,8 @@ Converter CanonicalUnit::getConverterFrom(const RefLogUnit& output) const
 
 Converter CanonicalUnit::getConverterFrom(const UnrefLogUnit& output) const
 {
-    //output.getConverterTo
-    throw logic_error("CanonicalUnit::getConverterFrom(UnrefLogUnit) shouldn't be called");
+    // Reached via UnrefLogUnit::getConverterTo()
+    throw invalid_argument("Units are not convertible");
 }
 
 CanonicalUnit::Pimpl CanonicalUnit::multiply(const Pimpl& other) const
@@ -218,30 +209,37 @@ CanonicalUnit::Pimpl CanonicalUnit::multiply(const Pimpl& other) const
 
 Unit::Pimpl CanonicalUnit::multiplyBy(const CanonicalUnit& other) const
 {
-    const CanonicalUnit* smaller;
-    const CanonicalUnit* larger;
-    if (factors.size() <= other.factors.size()) {
-        smaller = this;
-        larger = &other;
-    }
-    else {
-        larger = this;
-        smaller = &other;
-    }
+    // Linear merge of the two sorted sequences of factors
+    UnitFactors product;
+    product.reserve(factors.size() + other.factors.size());
 
-    auto newImpl = new CanonicalUnit(*larger);
+    auto       iter1 = factors.begin();
+    const auto end1 = factors.end();
+    auto       iter2 = other.factors.begin();
+    const auto end2 = other.factors.end();
 
-    for (const auto& factor : smaller->factors) {
-        auto iter = newImpl->factors.find(factor.first);
-        if (iter == newImpl->factors.end()) {
-            newImpl->factors.insert(factor);
+    while (iter1 != end1 && iter2 != end2) {
+        const auto cmp = iter1->first.compare(iter2->first);
+        if (cmp < 0) {
+            product.push_back(*iter1++);
+        }
+        else if (cmp > 0) {
+            product.push_back(*iter2++);
         }
         else {
-            iter->second = iter->second.add(factor.second);
+            const auto exp = iter1->second.add(iter2->second);
+            if (!exp.isZero())
+                product.emplace_back(iter1->first, exp);
+            ++iter1;
+            ++iter2;
         }
     }
+    for (; iter1 != end1; ++iter1)
+        product.push_back(*iter1);
+    for (; iter2 != end2; ++iter2)
+        product.push_back(*iter2);
 
-    return Pimpl(newImpl);
+    return intern(new CanonicalUnit(std::move(product)));
 }
 
 Unit::Pimpl CanonicalUnit::multiplyBy(const AffineUnit& other) const
@@ -251,12 +249,14 @@ Unit::Pimpl CanonicalUnit::multiplyBy(const AffineUnit& other) const
 
 Unit::Pimpl CanonicalUnit::pow(const Exponent exp) const
 {
-    auto newImpl = new CanonicalUnit(*this);
-
-    for (auto& factor : newImpl->factors)
-        factor.second = factor.second.multiply(exp);
+    UnitFactors power;
+    if (!exp.isZero()) {
+        power.reserve(factors.size());
+        for (const auto& factor : factors)
+            power.emplace_back(factor.first, factor.second.multiply(exp));
+    }
 
-    return Pimpl(newImpl);
+    return intern(new CanonicalUnit(std::move(power)));
 }
 
 } // Namespace
@@ -23,10 +23,12 @@
 #pragma once
 
 #include "Unit.h"
+#include "Arena.h"
 #include "BaseInfo.h"
 #include "Converter.h"
+#include "SmallVector.h"
 
-#include <map>
+#include <utility>
 
 using namespace std;
 
@@ -38,29 +40,26 @@ namespace quantity {
  * dimensionless unit one; a set with one factor is equivalent to a base unit.
  */
 class CanonicalUnit final : public Unit
+                          , public ArenaAllocated<AllocStats::Class::CANONICAL_UNIT>
 {
 private:
-    /// Comparison functor for information on base units
-    struct BaseInfoLess {
-        bool operator()(const BaseInfo& base1, const BaseInfo& base2) const {
-            return base1.compare(base2) < 0;
-        }
-    };
-
-    /// Container for unit factors.
-    using UnitFactors = map<const BaseInfo, Exponent, BaseInfoLess>;
-
     /// A unit factor
-    using UnitFactor = pair<const BaseInfo, Exponent>;
+    using UnitFactor = pair<BaseInfo, Exponent>;
+
+    /**
+     * Container for unit factors. Real units have few factors, so they're stored inline and sorted
+     * by base unit.
+     */
+    using UnitFactors = SmallVector<UnitFactor, 4>;
 
-    /// This instance's unit factors. No factor shall be the dimensionless unit one.
+    /// This instance's unit factors in order of increasing base unit. No exponent shall be zero.
     UnitFactors factors;
 
     /**
-     * Constructs from a set of base unit factors. Factors with an exponent of zero will be ignored.
-     * @param[in] factors A set of base unit factors
+     * Constructs from a sorted sequence of base unit factors with non-zero exponents.
+     * @param[in] factors A sorted sequence of base unit factors
      */
-    CanonicalUnit(const UnitFactors& factors);
+    CanonicalUnit(UnitFactors&& factors);
 
 public:
     /**
@@ -162,7 +161,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertible(const Pimpl& other) const override;
+    bool isConvertible(const Pimpl& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with a derived unit.
@@ -170,7 +169,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const CanonicalUnit& other) const override;
+    bool isConvertibleTo(const CanonicalUnit& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with an affine unit.
@@ -178,7 +177,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const AffineUnit& other) const override;
+    bool isConvertibleTo(const AffineUnit& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with a referenced logarithmic unit.
@@ -186,7 +185,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const RefLogUnit& other) const override;
+    bool isConvertibleTo(const RefLogUnit& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with an unreferenced logarithmic
@@ -195,7 +194,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const UnrefLogUnit& other) const override;
+    bool isConvertibleTo(const UnrefLogUnit& other) const noexcept override;
 
     /**
      * Returns a converter of numeric values to an output unit.
@@ -22,18 +22,161 @@
 
 #include "Converter.h"
 #include "ConverterImpl.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <unistd.h>
 
 using namespace std;
 
 namespace quantity {
 
-Converter::Converter(ConverterImpl* impl)
+/// Number of values below which a parallel conversion is serial: 2 MiB
+static constexpr size_t PARALLEL_THRESHOLD = size_t(1) << 18;
+/// Minimum number of values in a chunk of a parallel conversion: 256 KiB (a typical level-2 cache)
+static constexpr size_t MIN_CHUNK_SIZE = size_t(1) << 15;
+/// Number of chunks per thread of a parallel conversion so that work-stealing can balance the load
+static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+/**
+ * Returns the number of bytes in a page of memory (e.g., 4 KiB on x86-64 but often 64 KiB on arm64
+ * and ppc64). The system is queried once.
+ * @return The number of bytes in a page of memory
+ */
+static size_t getPageBytes()
+{
+    static const size_t bytes = [] {
+        const auto size = ::sysconf(_SC_PAGESIZE);
+        return size > 0 ? static_cast<size_t>(size) : size_t(4096);
+    }();
+    return bytes;
+}
+
+Converter::Converter(ConverterImpl* impl, const Accuracy accuracy)
     : pImpl(impl)
+    , accuracy(accuracy)
+    , floatPrecision(FloatPrecision::SINGLE)
 {}
 
+Converter::Converter(const Pimpl& impl, const Accuracy accuracy)
+    : pImpl(impl)
+    , accuracy(accuracy)
+    , floatPrecision(FloatPrecision::SINGLE)
+{}
+
+Converter Converter::withAccuracy(const Accuracy accuracy) const
+{
+    Converter converter(*this);
+    converter.accuracy = accuracy;
+    return converter;
+}
+
+Converter::Accuracy Converter::getAccuracy() const
+{
+    return accuracy;
+}
+
+Converter Converter::withFloatPrecision(const FloatPrecision precision) const
+{
+    Converter converter(*this);
+    converter.floatPrecision = precision;
+    return converter;
+}
+
+Converter::FloatPrecision Converter::getFloatPrecision() const
+{
+    return floatPrecision;
+}
+
+Converter Converter::inverse() const
+{
+    auto impl = pImpl->inverse();
+    if (!impl)
+        throw logic_error("Converter can't be inverted");
+    Converter converter(*this);
+    converter.pImpl = impl;
+    return converter;
+}
+
 double Converter::operator()(const double value) const
 {
     return pImpl->operator()(value);
 }
 
+void Converter::convert(const double* in, double* out, const size_t n) const
+{
+    pImpl->convert(in, out, n, accuracy);
+}
+
+void Converter::convert(double* values, const size_t n) const
+{
+    pImpl->convert(values, values, n, accuracy);
+}
+
+void Converter::parallelConvert(const double* in, double* out, const size_t n) const
+{
+    parallelConvert(in, out, n, ThreadPool::getInstance());
+}
+
+void Converter::parallelConvert(const double* in,
+                                double*       out,
+                                const size_t  n,
+                                ThreadPool&   pool) const
+{
+    if (n < PARALLEL_THRESHOLD || pool.size() == 0) {
+        pImpl->convert(in, out, n, accuracy);
+        return;
+    }
+
+    // Chunks are whole pages and begin on the output's page boundaries except for the first, which
+    // also contains the values before the first boundary
+    const auto pageBytes = getPageBytes();
+    const auto pageValues = std::max<size_t>(1, pageBytes/sizeof(double));
+    const auto numThreads = pool.size() + 1; // The calling thread helps
+    auto       chunkSize = std::max(MIN_CHUNK_SIZE, n/(numThreads*CHUNKS_PER_THREAD));
+    chunkSize = (chunkSize + pageValues - 1)/pageValues*pageValues;
+    const auto head = std::min(n, (pageBytes - reinterpret_cast<uintptr_t>(out) % pageBytes) %
+            pageBytes/sizeof(double));
+    const auto numChunks = std::max<size_t>(1, (n - head + chunkSize - 1)/chunkSize);
+
+    pool.parallelFor(numChunks, [&](const size_t chunk) {
+        const auto begin = chunk == 0 ? 0 : head + chunk*chunkSize;
+        const auto end = std::min(n, head + (chunk + 1)*chunkSize);
+        pImpl->convert(in + begin, out + begin, end - begin, accuracy);
+    });
+}
+
+void Converter::convert(const void*  in,
+                        const size_t inStride,
+                        void*        out,
+                        const size_t outStride,
+                        const size_t n) const
+{
+    if (inStride == sizeof(double) && outStride == sizeof(double) &&
+            reinterpret_cast<uintptr_t>(in) % alignof(double) == 0 &&
+            reinterpret_cast<uintptr_t>(out) % alignof(double) == 0) {
+        pImpl->convert(static_cast<const double*>(in), static_cast<double*>(out), n, accuracy);
+    }
+    else {
+        pImpl->convert(in, inStride, out, outStride, n, accuracy);
+    }
+}
+
+void Converter::convert(const float* in, float* out, const size_t n) const
+{
+    pImpl->convert(in, out, n, accuracy, floatPrecision);
+}
+
+void Converter::convert(float* values, const size_t n) const
+{
+    pImpl->convert(values, values, n, accuracy, floatPrecision);
+}
+
+void Converter::convert(const float* in, double* out, const size_t n) const
+{
+    pImpl->convert(in, out, n, accuracy);
+}
+
 } // Namespace
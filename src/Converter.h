@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 using namespace std;
@@ -29,6 +30,7 @@ using namespace std;
 namespace quantity {
 
 class ConverterImpl;
+class ThreadPool;
 
 /// Converter of numeric values in an input unit to the equivalent values in an output unit.
 class Converter
@@ -36,14 +38,85 @@ class Converter
 public:
 	using Pimpl = shared_ptr<ConverterImpl>;	///< Type of smart pointer to an implementation
 
+	/**
+	 * Accuracy of array conversions. Scalar conversions always use the C math library.
+	 */
+	enum class Accuracy {
+	    FULL,   ///< Logarithms and exponentials are computed by the C math library
+	    FAST    ///< Logarithms and exponentials are computed by vectorized kernels whose error is
+	            ///< at most 2 ULP (see Simd::TranscendentalKernel)
+	};
+
+	/**
+	 * Precision of the arithmetic of linear conversions of single-precision arrays. Non-linear
+	 * conversions of single-precision arrays are always computed in double precision.
+	 */
+	enum class FloatPrecision {
+	    SINGLE, ///< The coefficients are rounded to single precision, so twice as many values are
+	            ///< converted per instruction
+	    DOUBLE  ///< The coefficients are kept in double precision and each value is widened,
+	            ///< converted, and rounded back to single precision
+	};
+
 	Pimpl pImpl;					            ///< Smart pointer to an implementation
 
+private:
+	Accuracy       accuracy;                    ///< Accuracy of array conversions
+	FloatPrecision floatPrecision;              ///< Precision of single-precision array conversions
+
+public:
 	/**
 	 * Constructs from a pointer to an implementation, for which it assumes responsibility for
 	 * deleting when it is no longer used.
-	 * @param[in] impl  Pointer to an implementation. Deleted by this class's destructor.
+	 * @param[in] impl      Pointer to an implementation. Deleted by this class's destructor.
+	 * @param[in] accuracy  Accuracy of array conversions
+	 */
+	Converter(ConverterImpl* impl, const Accuracy accuracy = Accuracy::FULL);
+
+	/**
+	 * Constructs from a shared implementation.
+	 * @param[in] impl      Smart pointer to an implementation
+	 * @param[in] accuracy  Accuracy of array conversions
+	 */
+	explicit Converter(const Pimpl& impl, const Accuracy accuracy = Accuracy::FULL);
+
+	/**
+	 * Returns a converter that shares this instance's implementation but has a different accuracy
+	 * for array conversions.
+	 * @param[in] accuracy  Accuracy of array conversions
+	 * @return              The converter
 	 */
-	Converter(ConverterImpl* impl);
+	Converter withAccuracy(const Accuracy accuracy) const;
+
+	/**
+	 * Returns the accuracy of array conversions.
+	 * @return The accuracy of array conversions
+	 */
+	Accuracy getAccuracy() const;
+
+	/**
+	 * Returns a converter that shares this instance's implementation but has a different precision
+	 * for linear conversions of single-precision arrays.
+	 * @param[in] precision Precision of linear conversions of single-precision arrays
+	 * @return              The converter
+	 */
+	Converter withFloatPrecision(const FloatPrecision precision) const;
+
+	/**
+	 * Returns the precision of linear conversions of single-precision arrays. The default is
+	 * FloatPrecision::SINGLE.
+	 * @return The precision of linear conversions of single-precision arrays
+	 */
+	FloatPrecision getFloatPrecision() const;
+
+	/**
+	 * Returns the inverse of this converter, which converts numeric values in the output unit to
+	 * the input unit. It's derived analytically from this instance's transformation rather than by
+	 * obtaining a converter between the units, and it has this instance's accuracy and precision.
+	 * @return                  The inverse converter
+	 * @throw std::logic_error  The inverse can't be derived from this converter
+	 */
+	Converter inverse() const;
 
 	/**
 	 * Converts a numeric value.
@@ -52,7 +125,109 @@ public:
 	 */
 	double operator()(const double value) const;
 
-	// Add more conversion methods here (i.e., conversion or arrays, iterators, etc.).
+	/**
+	 * Converts an array of numeric values with this instance's accuracy. The input and output
+	 * arrays may be the same array but must not otherwise overlap.
+	 * @param[in]  in       Numeric values in the old unit
+	 * @param[out] out      Equivalent numeric values in the new unit
+	 * @param[in]  n        Number of values
+	 */
+	void convert(const double* in, double* out, const size_t n) const;
+
+	/**
+	 * Converts an array of numeric values in place with this instance's accuracy.
+	 * @param[in,out] values    Numeric values in the old unit on input; equivalent numeric values
+	 *                          in the new unit on output
+	 * @param[in]     n         Number of values
+	 */
+	void convert(double* values, const size_t n) const;
+
+	/**
+	 * Converts an array of numeric values with this instance's accuracy using the process-wide
+	 * thread pool.
+	 * @param[in]  in       Numeric values in the old unit
+	 * @param[out] out      Equivalent numeric values in the new unit
+	 * @param[in]  n        Number of values
+	 * @see parallelConvert(const double*, double*, size_t, ThreadPool&)
+	 * @see ThreadPool::getInstance()
+	 */
+	void parallelConvert(const double* in, double* out, const size_t n) const;
+
+	/**
+	 * Converts an array of numeric values with this instance's accuracy using a thread pool. The
+	 * input and output arrays may be the same array but must not otherwise overlap. Arrays smaller
+	 * than a threshold (about two megabytes) are converted serially by the calling thread. Larger
+	 * arrays are divided into chunks that
+	 *   - Are large enough (at least 256 KiB) to amortize the cost of a task;
+	 *   - Number several per thread so that work-stealing can balance the load; and
+	 *   - Begin on page boundaries of the output array, so no two threads write the same page.
+	 * Each thread initially receives a contiguous range of chunks, so an array that was first
+	 * touched with the same division is converted by the threads on its NUMA nodes.
+	 * @param[in]  in       Numeric values in the old unit
+	 * @param[out] out      Equivalent numeric values in the new unit
+	 * @param[in]  n        Number of values
+	 * @param[in]  pool     The thread pool
+	 */
+	void parallelConvert(const double* in,
+	                     double*       out,
+	                     const size_t  n,
+	                     ThreadPool&   pool) const;
+
+	/**
+	 * Converts double-precision numeric values that are evenly spaced in memory (e.g., a field of
+	 * an array of structures) with this instance's accuracy. The values needn't be aligned, so the
+	 * structures may be packed. The input and output may be the same values (i.e., @ in equals
+	 * @ out and @ inStride equals @ outStride) but must not otherwise overlap.
+	 * @param[in]  in           First numeric value in the old unit (e.g., `&records[0].temp`)
+	 * @param[in]  inStride     Number of bytes from one input value to the next (e.g.,
+	 *                          `sizeof(Record)`). At least `sizeof(double)`.
+	 * @param[out] out          First equivalent numeric value in the new unit
+	 * @param[in]  outStride    Number of bytes from one output value to the next. At least
+	 *                          `sizeof(double)`.
+	 * @param[in]  n            Number of values
+	 */
+	void convert(const void*  in,
+	             const size_t inStride,
+	             void*        out,
+	             const size_t outStride,
+	             const size_t n) const;
+
+	/**
+	 * Converts an array of single-precision numeric values with this instance's accuracy and
+	 * single-precision arithmetic precision. The input and output arrays may be the same array but
+	 * must not otherwise overlap.
+	 * @param[in]  in       Numeric values in the old unit
+	 * @param[out] out      Equivalent numeric values in the new unit
+	 * @param[in]  n        Number of values
+	 */
+	void convert(const float* in, float* out, const size_t n) const;
+
+	/**
+	 * Converts an array of single-precision numeric values in place with this instance's accuracy
+	 * and single-precision arithmetic precision.
+	 * @param[in,out] values    Numeric values in the old unit on input; equivalent numeric values
+	 *                          in the new unit on output
+	 * @param[in]     n         Number of values
+	 */
+	void convert(float* values, const size_t n) const;
+
+	/**
+	 * Converts an array of single-precision numeric values to double precision with this instance's
+	 * accuracy. The conversion is computed in double precision. The arrays must not overlap.
+	 * @param[in]  in       Numeric values in the old unit
+	 * @param[out] out      Equivalent numeric values in the new unit
+	 * @param[in]  n        Number of values
+	 */
+	void convert(const float* in, double* out, const size_t n) const;
+
+	// Add more conversion methods here (i.e., iterators, etc.).
+};
+
+/// Converters of numeric values between two units in both directions.
+struct BidirectionalConverter
+{
+    Converter forward;  ///< Converter of numeric values in the first unit to the second
+    Converter backward; ///< Converter of numeric values in the second unit to the first
 };
 
 } // namespace quantity
@@ -0,0 +1,304 @@
+/**
+ * This file implements a concurrent, bounded cache of converters between units.
+ *
+ *        File: ConverterCache.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ConverterCache.h"
+#include "ConverterImpl.h"
+
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace std;
+
+namespace quantity {
+
+/// A shard of a converter cache: a least-recently-used list of entries under a single lock.
+class ConverterCacheShard final
+{
+private:
+    /// An entry in the cache
+    struct Entry {
+        size_t               hash;      ///< Hash code of the (input, output) pair
+        weak_ptr<const Unit> input;     ///< Input unit
+        weak_ptr<const Unit> output;    ///< Output unit
+        Converter::Pimpl     converter; ///< Converter from the input unit to the output unit
+    };
+
+    using List = list<Entry>;                               ///< Type of LRU list
+    using Index = unordered_multimap<size_t, List::iterator>; ///< Type of index into the list
+
+    mutable std::mutex lock;        ///< Protects this instance
+    List               lru;         ///< Entries in order of most- to least-recently used
+    Index              index;       ///< Index of entries by hash code
+    size_t             capacity;    ///< Maximum number of entries
+    uint64_t           hits;        ///< Number of successful lookups
+    uint64_t           misses;      ///< Number of unsuccessful lookups
+    uint64_t           evictions;   ///< Number of removed entries
+
+    /**
+     * Indicates if a unit referenced by an entry is the same as a given unit.
+     * @param[in] entryUnit The unit of the entry
+     * @param[in] unit      The given unit
+     * @retval    true      The units are the same
+     * @retval    false     The units are not the same
+     */
+    static bool matches(const Unit::Pimpl& entryUnit,
+                        const Unit::Pimpl& unit)
+    {
+        return entryUnit.get() == unit.get() || entryUnit->compare(unit) == 0;
+    }
+
+    /**
+     * Removes an entry.
+     * @pre                 The lock is held
+     * @param[in] indexIter Iterator of the entry in the index
+     * @return              Iterator of the next entry in the index
+     */
+    Index::iterator erase(const Index::iterator indexIter)
+    {
+        lru.erase(indexIter->second);
+        ++evictions;
+        return index.erase(indexIter);
+    }
+
+    /**
+     * Returns the converter of the entry matching a pair of units, discarding entries whose units
+     * have been destroyed. A matching entry becomes the most-recently used.
+     * @pre                 The lock is held
+     * @param[in] hash      Hash code of the pair of units
+     * @param[in] input     The input unit
+     * @param[in] output    The output unit
+     * @retval    nullptr   No entry matches
+     * @return              The converter of the matching entry
+     */
+    Converter::Pimpl lookup(const size_t       hash,
+                            const Unit::Pimpl& input,
+                            const Unit::Pimpl& output)
+    {
+        auto range = index.equal_range(hash);
+        for (auto iter = range.first; iter != range.second; ) {
+            const auto entryIter = iter->second;
+            const auto entryInput = entryIter->input.lock();
+            const auto entryOutput = entryIter->output.lock();
+            if (!entryInput || !entryOutput) {
+                iter = erase(iter);
+            }
+            else if (matches(entryInput, input) && matches(entryOutput, output)) {
+                lru.splice(lru.begin(), lru, entryIter);
+                return entryIter->converter;
+            }
+            else {
+                ++iter;
+            }
+        }
+        return Converter::Pimpl{};
+    }
+
+public:
+    /// Default constructs.
+    ConverterCacheShard()
+        : lock()
+        , lru()
+        , index()
+        , capacity(1)
+        , hits(0)
+        , misses(0)
+        , evictions(0)
+    {}
+
+    /**
+     * Sets the capacity.
+     * @param[in] capacity  Maximum number of entries
+     */
+    void setCapacity(const size_t capacity)
+    {
+        lock_guard<std::mutex> guard{lock};
+        this->capacity = capacity;
+    }
+
+    /**
+     * Returns the cached converter between two units.
+     * @param[in] hash      Hash code of the pair of units
+     * @param[in] input     The input unit
+     * @param[in] output    The output unit
+     * @retval    nullptr   The converter isn't cached
+     * @return              The cached converter
+     */
+    Converter::Pimpl find(const size_t       hash,
+                          const Unit::Pimpl& input,
+                          const Unit::Pimpl& output)
+    {
+        lock_guard<std::mutex> guard{lock};
+        auto converter = lookup(hash, input, output);
+        if (converter) {
+            ++hits;
+        }
+        else {
+            ++misses;
+        }
+        return converter;
+    }
+
+    /**
+     * Adds a converter between two units. If another thread added a converter for the same units in
+     * the meantime, then that converter is returned instead so that all callers share it.
+     * @param[in] hash      Hash code of the pair of units
+     * @param[in] input     The input unit
+     * @param[in] output    The output unit
+     * @param[in] converter The converter from @ input to @ output
+     * @return              The cached converter from @ input to @ output
+     */
+    Converter::Pimpl add(const size_t            hash,
+                         const Unit::Pimpl&      input,
+                         const Unit::Pimpl&      output,
+                         const Converter::Pimpl& converter)
+    {
+        lock_guard<std::mutex> guard{lock};
+        auto existing = lookup(hash, input, output);
+        if (existing)
+            return existing;
+
+        while (lru.size() >= capacity) {
+            auto range = index.equal_range(lru.back().hash);
+            for (auto iter = range.first; iter != range.second; ++iter) {
+                if (iter->second == std::prev(lru.end())) {
+                    erase(iter);
+                    break;
+                }
+            }
+        }
+        lru.push_front(Entry{hash, input, output, converter});
+        index.emplace(hash, lru.begin());
+        return converter;
+    }
+
+    /**
+     * Adds the statistics of this instance to a total.
+     * @param[in,out] stats The total
+     */
+    void addStats(ConverterCache::Stats& stats) const
+    {
+        lock_guard<std::mutex> guard{lock};
+        stats.hits += hits;
+        stats.misses += misses;
+        stats.evictions += evictions;
+        stats.size += lru.size();
+    }
+
+    /// Removes all entries and zeros the statistics.
+    void clear()
+    {
+        lock_guard<std::mutex> guard{lock};
+        index.clear();
+        lru.clear();
+        hits = misses = evictions = 0;
+    }
+};
+
+ConverterCache::ConverterCache(const size_t capacity,
+                               const size_t numShards)
+    : numShards(numShards)
+    , shards()
+{
+    if (capacity == 0)
+        throw invalid_argument("Converter cache capacity is zero");
+    if (numShards == 0)
+        throw invalid_argument("Number of converter cache shards is zero");
+
+    shards.reset(new ConverterCacheShard[numShards]);
+    const auto shardCapacity = (capacity + numShards - 1)/numShards;
+    for (size_t i = 0; i < numShards; ++i)
+        shards[i].setCapacity(shardCapacity);
+}
+
+ConverterCache::~ConverterCache() noexcept =default;
+
+ConverterCache& ConverterCache::getInstance()
+{
+    static ConverterCache instance;
+    return instance;
+}
+
+/**
+ * Returns the hash code of a pair of units.
+ * @param[in] input     The input unit
+ * @param[in] output    The output unit
+ * @return              The hash code of the pair
+ */
+static size_t hashPair(const Unit::Pimpl& input,
+                       const Unit::Pimpl& output)
+{
+    // Hash combination as in boost::hash_combine()
+    auto hash = input->hash();
+    hash ^= output->hash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+Converter ConverterCache::get(const Unit::Pimpl& input,
+                              const Unit::Pimpl& output)
+{
+    const auto hash = hashPair(input, output);
+    auto& shard = shards[hash % numShards];
+    auto  converter = shard.find(hash, input, output);
+    if (!converter)
+        // Created without holding the shard's lock
+        converter = shard.add(hash, input, output, input->getConverterTo(output).pImpl);
+    return Converter(converter);
+}
+
+BidirectionalConverter ConverterCache::getBidirectional(const Unit::Pimpl& input,
+                                                        const Unit::Pimpl& output)
+{
+    auto forward = get(input, output);
+
+    const auto hash = hashPair(output, input);
+    auto&      shard = shards[hash % numShards];
+    auto       backward = shard.find(hash, output, input);
+    if (!backward) {
+        // Not cached: it can differ in the last place from the directly dispatched converter, which
+        // is what get(output, input) must return regardless of the order of the calls
+        backward = forward.pImpl->inverse();
+        if (!backward)
+            // Created without holding the shard's lock
+            backward = shard.add(hash, output, input, output->getConverterTo(input).pImpl);
+    }
+
+    return BidirectionalConverter{std::move(forward), Converter(backward)};
+}
+
+ConverterCache::Stats ConverterCache::getStats() const
+{
+    Stats stats{0, 0, 0, 0};
+    for (size_t i = 0; i < numShards; ++i)
+        shards[i].addStats(stats);
+    return stats;
+}
+
+void ConverterCache::clear()
+{
+    for (size_t i = 0; i < numShards; ++i)
+        shards[i].clear();
+}
+
+} // namespace quantity
@@ -0,0 +1,117 @@
+/**
+ * This file declares a concurrent, bounded cache of converters between units.
+ *
+ *        File: ConverterCache.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Converter.h"
+#include "Unit.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace quantity {
+
+class ConverterCacheShard;
+
+/**
+ * A concurrent, bounded cache of converters keyed by (input unit, output unit). Units are matched by
+ * value (i.e., Unit::hash() and Unit::compare()), so equal units that are different objects share
+ * an entry. The cache only weakly references its units: it doesn't extend their lifetime and an
+ * entry whose unit has been destroyed is discarded. The cache is divided into independently locked
+ * shards, each of which evicts its least-recently used entry when full.
+ * @threadsafety Safe
+ */
+class ConverterCache final
+{
+public:
+    /// Statistics of a cache
+    struct Stats {
+        uint64_t hits;       ///< Number of lookups that found an entry
+        uint64_t misses;     ///< Number of lookups that didn't find an entry
+        uint64_t evictions;  ///< Number of entries removed because of capacity or a destroyed unit
+        size_t   size;       ///< Current number of entries
+    };
+
+    /**
+     * Constructs.
+     * @param[in] capacity          Maximum number of entries. Rounded up to a multiple of
+     *                              @ numShards.
+     * @param[in] numShards         Number of independently locked shards
+     * @throw std::invalid_argument @ capacity or @ numShards is zero
+     */
+    explicit ConverterCache(const size_t capacity = 4096,
+                            const size_t numShards = 16);
+
+    /// Destroys.
+    ~ConverterCache() noexcept;
+
+    ConverterCache(const ConverterCache& other) =delete;
+    ConverterCache& operator=(const ConverterCache& rhs) =delete;
+
+    /**
+     * Returns the process-wide cache used by Unit::getConverter().
+     * @return The process-wide cache
+     */
+    static ConverterCache& getInstance();
+
+    /**
+     * Returns the converter of numeric values in one unit to another, creating and caching it if
+     * necessary. The returned converter shares its implementation with every other converter
+     * returned for equal units and has full accuracy.
+     * @param[in] input                 The input unit
+     * @param[in] output                The output unit
+     * @return                          The converter from @ input to @ output
+     * @throw     std::invalid_argument Values aren't convertible between the two units
+     */
+    Converter get(const Unit::Pimpl& input,
+                  const Unit::Pimpl& output);
+
+    /**
+     * Returns the converters of numeric values between two units in both directions. The forward
+     * converter is obtained as by get(). If the backward converter isn't cached, then it's derived
+     * from the forward converter by Converter::inverse() rather than by a second conversion
+     * dispatch and isn't cached, so get() for the reverse direction is unaffected by this
+     * function. Both converters have full accuracy.
+     * @param[in] input                 The first unit
+     * @param[in] output                The second unit
+     * @return                          The converters from @ input to @ output and back
+     * @throw     std::invalid_argument Values aren't convertible between the two units
+     */
+    BidirectionalConverter getBidirectional(const Unit::Pimpl& input,
+                                            const Unit::Pimpl& output);
+
+    /**
+     * Returns the statistics of this instance.
+     * @return The statistics of this instance
+     */
+    Stats getStats() const;
+
+    /// Removes all entries and zeros the statistics.
+    void clear();
+
+private:
+    size_t                                 numShards;  ///< Number of shards
+    std::unique_ptr<ConverterCacheShard[]> shards;     ///< The shards
+};
+
+} // namespace quantity
@@ -22,10 +22,17 @@
 
 #pragma once
 
+#include "AllocStats.h"
+#include "Converter.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
 namespace quantity {
 
 /// Interface for converter implementations.
-class ConverterImpl
+class ConverterImpl : public AllocCounted<AllocStats::Class::CONVERTER>
 {
 public:
     /// Destroys.
@@ -37,6 +44,117 @@ public:
 	 * @return              The equivalent numeric value in the output unit
 	 */
 	virtual double operator()(const double value) const =0;
+
+	/**
+	 * Returns the inverse of this converter (i.e., the converter of numeric values in the output
+	 * unit to the input unit). This default implementation returns nullptr.
+	 * @retval    nullptr   The inverse can't be derived from this converter
+	 * @return              The inverse converter
+	 */
+	virtual Converter::Pimpl inverse() const
+	{
+	    return Converter::Pimpl{};
+	}
+
+	/**
+	 * Converts an array of numeric values in the input unit to the equivalent values in the output
+	 * unit. The input and output arrays may be the same array but must not otherwise overlap. This
+	 * default implementation calls operator()() on each value; subclasses should override it with a
+	 * tight loop.
+	 * @param[in]  in       The numeric values in the input unit
+	 * @param[out] out      The equivalent numeric values in the output unit
+	 * @param[in]  n        The number of values
+	 * @param[in]  accuracy Accuracy of logarithms and exponentials
+	 */
+	virtual void convert(const double*             in,
+	                     double*                   out,
+	                     const size_t              n,
+	                     const Converter::Accuracy accuracy) const
+	{
+	    for (size_t i = 0; i < n; ++i)
+	        out[i] = operator()(in[i]);
+	}
+
+	/**
+	 * Converts numeric values in the input unit that are evenly spaced in memory to the equivalent
+	 * values in the output unit. The input and output may be the same values but must not otherwise
+	 * overlap. This default implementation gathers the values a cache-resident chunk at a time,
+	 * converts each chunk contiguously, and scatters the results.
+	 * @param[in]  in           First numeric value in the input unit. Needn't be aligned.
+	 * @param[in]  inStride     Number of bytes from one input value to the next
+	 * @param[out] out          First equivalent numeric value in the output unit. Needn't be
+	 *                          aligned.
+	 * @param[in]  outStride    Number of bytes from one output value to the next
+	 * @param[in]  n            The number of values
+	 * @param[in]  accuracy     Accuracy of logarithms and exponentials
+	 */
+	virtual void convert(const void*               in,
+	                     const size_t              inStride,
+	                     void*                     out,
+	                     const size_t              outStride,
+	                     const size_t              n,
+	                     const Converter::Accuracy accuracy) const
+	{
+	    static constexpr size_t CHUNK_SIZE = 256;
+	    double                  buf[CHUNK_SIZE];
+	    auto                    inBytes = static_cast<const char*>(in);
+	    auto                    outBytes = static_cast<char*>(out);
+	    for (size_t start = 0; start < n; start += CHUNK_SIZE) {
+	        const auto count = std::min(CHUNK_SIZE, n - start);
+	        for (size_t i = 0; i < count; ++i, inBytes += inStride)
+	            ::memcpy(buf + i, inBytes, sizeof(double));
+	        convert(buf, buf, count, accuracy);
+	        for (size_t i = 0; i < count; ++i, outBytes += outStride)
+	            ::memcpy(outBytes, buf + i, sizeof(double));
+	    }
+	}
+
+	/**
+	 * Converts an array of single-precision numeric values in the input unit to the equivalent
+	 * values in the output unit. The input and output arrays may be the same array but must not
+	 * otherwise overlap. This default implementation widens the values a cache-resident chunk at a
+	 * time, converts each chunk in double precision, and rounds the results to single precision, so
+	 * it ignores @ precision.
+	 * @param[in]  in        The numeric values in the input unit
+	 * @param[out] out       The equivalent numeric values in the output unit
+	 * @param[in]  n         The number of values
+	 * @param[in]  accuracy  Accuracy of logarithms and exponentials
+	 * @param[in]  precision Precision of linear arithmetic
+	 */
+	virtual void convert(const float*                    in,
+	                     float*                          out,
+	                     const size_t                    n,
+	                     const Converter::Accuracy       accuracy,
+	                     const Converter::FloatPrecision precision) const
+	{
+	    static constexpr size_t CHUNK_SIZE = 256;
+	    double                  buf[CHUNK_SIZE];
+	    for (size_t start = 0; start < n; start += CHUNK_SIZE) {
+	        const auto count = std::min(CHUNK_SIZE, n - start);
+	        std::copy(in + start, in + start + count, buf);
+	        convert(buf, buf, count, accuracy);
+	        for (size_t i = 0; i < count; ++i)
+	            out[start + i] = static_cast<float>(buf[i]);
+	    }
+	}
+
+	/**
+	 * Converts an array of single-precision numeric values in the input unit to the equivalent
+	 * double-precision values in the output unit. The arrays must not overlap. This default
+	 * implementation widens the values into the output array and converts them in place.
+	 * @param[in]  in       The numeric values in the input unit
+	 * @param[out] out      The equivalent numeric values in the output unit
+	 * @param[in]  n        The number of values
+	 * @param[in]  accuracy Accuracy of logarithms and exponentials
+	 */
+	virtual void convert(const float*              in,
+	                     double*                   out,
+	                     const size_t              n,
+	                     const Converter::Accuracy accuracy) const
+	{
+	    std::copy(in, in + n, out);
+	    convert(out, out, n, accuracy);
+	}
 };
 
 } // namespace quantity
@@ -0,0 +1,326 @@
+/**
+ * This file implements an intermediate representation of converters that's used to simplify them
+ * into a flat, minimal sequence of operations.
+ *
+ *        File: ConverterIr.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ConverterIr.h"
+#include "ConverterImpl.h"
+#include "LinearConverter.h"
+#include "Simd.h"
+
+#include <cfloat>
+#include <cmath>
+#include <utility>
+
+using namespace std;
+
+namespace quantity {
+
+/**
+ * Returns a multiplier that's within rounding error of one as exactly one so that, for example,
+ * "exp(x*log(10))" followed by "log(x)/log(10)" becomes the identity.
+ * @param[in] scale The multiplier
+ * @return          The multiplier or one
+ */
+static double snap(const double scale)
+{
+    return std::abs(scale - 1) <= 4*DBL_EPSILON ? 1 : scale;
+}
+
+/**
+ * Returns a linear operation.
+ * @param[in] offset    Value subtracted from the input
+ * @param[in] scale     Multiplier of the offset input
+ * @param[in] intercept Value added to the scaled input
+ * @return              The linear operation
+ */
+static ConverterIr::Op linearOp(const double offset,
+                                const double scale,
+                                const double intercept)
+{
+    return ConverterIr::Op{ConverterIr::OpCode::LINEAR, offset, scale, intercept, nullptr};
+}
+
+/**
+ * Indicates if an operation is the identity transformation.
+ * @param[in] op    The operation
+ * @retval true     The operation is the identity transformation
+ * @retval false    The operation is not the identity transformation
+ */
+static bool isIdentity(const ConverterIr::Op& op)
+{
+    return op.opCode == ConverterIr::OpCode::LINEAR && op.offset == 0 && op.scale == 1 &&
+            op.intercept == 0;
+}
+
+/**
+ * Indicates if an operation is a multiplication by a positive number (i.e., "y = scale*x", where
+ * "scale > 0"), whose logarithm is therefore defined.
+ * @param[in] op    The operation
+ * @retval true     The operation is a multiplication by a positive number
+ * @retval false    The operation is not a multiplication by a positive number
+ */
+static bool isPositiveScaling(const ConverterIr::Op& op)
+{
+    return op.opCode == ConverterIr::OpCode::LINEAR && op.scale > 0 &&
+            op.intercept == op.scale*op.offset;
+}
+
+double ConverterIr::Op::operator()(const double value) const
+{
+    switch (opCode) {
+        case OpCode::LINEAR: return Simd::linear(value, offset, scale, intercept);
+        case OpCode::LOG:    return scale*std::log(value);
+        case OpCode::EXP:    return std::exp(scale*value);
+        default:             return (*call)(value);
+    }
+}
+
+/// Converter that executes a sequence of operations.
+class ConverterIr::Program final : public ConverterImpl
+{
+private:
+    const Ops ops;  ///< Operations in the order in which they're applied
+
+public:
+    /**
+     * Constructs.
+     * @param[in] ops   Operations in the order in which they're applied. Moved.
+     */
+    explicit Program(Ops&& ops)
+        : ops(std::move(ops))
+    {}
+
+    /**
+     * Returns the operations.
+     * @return The operations in the order in which they're applied
+     */
+    const Ops& getOps() const
+    {
+        return ops;
+    }
+
+    Converter::Pimpl inverse() const override
+    {
+        ConverterIr ir;
+        ir.ops = ops;
+        return ir.invert()
+                ? ir.compile().pImpl
+                : Converter::Pimpl{};
+    }
+
+    double operator()(double value) const override
+    {
+        for (const auto& op : ops)
+            value = op(value);
+        return value;
+    }
+
+    /**
+     * Converts an array of numeric values. The first operation reads the input array; the rest
+     * work in place on the output array.
+     * @param[in]  in       The numeric values in the input unit
+     * @param[out] out      The equivalent numeric values in the output unit
+     * @param[in]  n        The number of values
+     * @param[in]  accuracy Accuracy of logarithms and exponentials
+     */
+    void convert(const double*             in,
+                 double*                   out,
+                 const size_t              n,
+                 const Converter::Accuracy accuracy) const override
+    {
+        const bool fast = accuracy == Converter::Accuracy::FAST;
+        for (const auto& op : ops) {
+            switch (op.opCode) {
+                case OpCode::LINEAR:
+                    Simd::linear(in, out, n, op.offset, op.scale, op.intercept);
+                    break;
+                case OpCode::LOG:
+                    if (fast) {
+                        Simd::log(in, out, n, op.scale);
+                    }
+                    else {
+                        for (size_t i = 0; i < n; ++i)
+                            out[i] = op.scale*std::log(in[i]);
+                    }
+                    break;
+                case OpCode::EXP:
+                    if (fast) {
+                        Simd::exp(in, out, n, op.scale);
+                    }
+                    else {
+                        for (size_t i = 0; i < n; ++i)
+                            out[i] = std::exp(op.scale*in[i]);
+                    }
+                    break;
+                default:
+                    op.call->convert(in, out, n, accuracy);
+            }
+            in = out;
+        }
+    }
+};
+
+ConverterIr ConverterIr::lower(const Converter& converter)
+{
+    ConverterIr ir;
+
+    if (const auto linear = LinearConverter::cast(converter)) {
+        ir.linear(linear->getOffset(), linear->getScale(), linear->getIntercept());
+    }
+    else if (const auto program = dynamic_cast<const Program*>(converter.pImpl.get())) {
+        ir.ops = program->getOps();
+    }
+    else {
+        ir.ops.push_back(Op{OpCode::CALL, 0, 1, 0, converter.pImpl});
+    }
+
+    return ir;
+}
+
+ConverterIr& ConverterIr::linear(const double offset,
+                                 const double scale,
+                                 const double intercept)
+{
+    ops.push_back(linearOp(offset, scale, intercept));
+    return *this;
+}
+
+ConverterIr& ConverterIr::log(const double scale)
+{
+    ops.push_back(Op{OpCode::LOG, 0, scale, 0, nullptr});
+    return *this;
+}
+
+ConverterIr& ConverterIr::exp(const double scale)
+{
+    ops.push_back(Op{OpCode::EXP, 0, scale, 0, nullptr});
+    return *this;
+}
+
+ConverterIr& ConverterIr::append(const Converter& converter)
+{
+    const auto ir = lower(converter);
+    ops.insert(ops.end(), ir.ops.begin(), ir.ops.end());
+    return *this;
+}
+
+bool ConverterIr::invert()
+{
+    Ops inverse;
+    inverse.reserve(ops.size());
+
+    for (auto op = ops.rbegin(); op != ops.rend(); ++op) {
+        switch (op->opCode) {
+            case OpCode::LINEAR:
+                // y = s*(x - o) + i  <=>  x = (1/s)*(y - i) + o
+                inverse.push_back(linearOp(op->intercept, 1/op->scale, op->offset));
+                break;
+            case OpCode::LOG:
+                // y = f*log(x)  <=>  x = exp((1/f)*y)
+                inverse.push_back(Op{OpCode::EXP, 0, 1/op->scale, 0, nullptr});
+                break;
+            case OpCode::EXP:
+                // y = exp(a*x)  <=>  x = (1/a)*log(y)
+                inverse.push_back(Op{OpCode::LOG, 0, 1/op->scale, 0, nullptr});
+                break;
+            default: {
+                auto call = op->call->inverse();
+                if (!call)
+                    return false;
+                inverse.push_back(Op{OpCode::CALL, 0, 1, 0, call});
+            }
+        }
+    }
+
+    ops.swap(inverse);
+    return true;
+}
+
+ConverterIr& ConverterIr::simplify()
+{
+    for (bool changed = true; changed; ) {
+        changed = false;
+        Ops result;
+        result.reserve(ops.size());
+
+        for (const auto& op : ops) {
+            if (isIdentity(op)) {
+                changed = true;
+                continue;
+            }
+
+            const auto size = result.size();
+            if (size >= 1) {
+                auto& prev = result.back();
+                if (prev.opCode == OpCode::LINEAR && op.opCode == OpCode::LINEAR) {
+                    // s2*((s1*(x - o1) + i1) - o2) + i2 = (s1*s2)*(x - o1) + (s2*(i1 - o2) + i2)
+                    prev = linearOp(prev.offset, prev.scale*op.scale,
+                            op.scale*(prev.intercept - op.offset) + op.intercept);
+                    changed = true;
+                    continue;
+                }
+                if (prev.opCode == OpCode::EXP && op.opCode == OpCode::LOG) {
+                    // f*log(exp(a*x)) = (a*f)*x
+                    prev = linearOp(0, snap(prev.scale*op.scale), 0);
+                    changed = true;
+                    continue;
+                }
+                if (size >= 2 && op.opCode == OpCode::LOG && isPositiveScaling(prev) &&
+                        result[size-2].opCode == OpCode::EXP) {
+                    // f*log(s*exp(a*x)) = (a*f)*x + f*log(s)
+                    const auto scale = prev.scale;
+                    result.pop_back();
+                    result.back() = linearOp(0, snap(result.back().scale*op.scale),
+                            op.scale*std::log(scale));
+                    changed = true;
+                    continue;
+                }
+            }
+
+            result.push_back(op);
+        }
+
+        ops.swap(result);
+    }
+
+    return *this;
+}
+
+const ConverterIr::Ops& ConverterIr::getOps() const
+{
+    return ops;
+}
+
+Converter ConverterIr::compile()
+{
+    simplify();
+
+    if (ops.empty())
+        return Converter(new LinearConverter());
+    if (ops.size() == 1 && ops[0].opCode == OpCode::LINEAR)
+        return Converter(new LinearConverter(ops[0].offset, ops[0].scale, ops[0].intercept));
+    if (ops.size() == 1 && ops[0].opCode == OpCode::CALL)
+        return Converter(ops[0].call);
+    return Converter(new Program(std::move(ops)));
+}
+
+} // namespace quantity
@@ -0,0 +1,155 @@
+/**
+ * This file declares an intermediate representation of converters that's used to simplify them
+ * into a flat, minimal sequence of operations.
+ *
+ *        File: ConverterIr.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Converter.h"
+
+#include <vector>
+
+namespace quantity {
+
+/**
+ * A converter as a sequence of primitive operations that are applied in order. Units build their
+ * converters by appending operations and the converters of their constituent units, which are
+ * lowered into their operations rather than nested. compile() then simplifies the sequence
+ * algebraically and returns a converter that executes it without indirection:
+ *   - Adjacent linear operations merge into one;
+ *   - Identity linear operations are removed;
+ *   - An exponential followed by a logarithm -- with at most a positive scaling between them --
+ *     cancels into a linear operation (e.g., the conversion from "lg(re m)" to "lg(re km)" is
+ *     "x - 3").
+ * A sequence that simplifies to a single linear operation becomes a LinearConverter.
+ */
+class ConverterIr final
+{
+public:
+    /// Kind of operation
+    enum class OpCode {
+        LINEAR, ///< "y = scale*(x - offset) + intercept"
+        LOG,    ///< "y = scale*log(x)"
+        EXP,    ///< "y = exp(scale*x)"
+        CALL    ///< "y = call(x)": an opaque converter
+    };
+
+    /// A primitive operation
+    struct Op
+    {
+        OpCode           opCode;    ///< Kind of operation
+        double           offset;    ///< Value subtracted from the input by LINEAR
+        double           scale;     ///< Multiplier of LINEAR, LOG, and EXP
+        double           intercept; ///< Value added to the scaled input by LINEAR
+        Converter::Pimpl call;      ///< Converter of CALL
+
+        /**
+         * Returns the value of this operation.
+         * @param[in] value     The input value
+         * @return              The output value
+         */
+        double operator()(const double value) const;
+    };
+
+    using Ops = std::vector<Op>;    ///< Sequence of operations
+
+private:
+    class Program;  ///< Converter that executes a sequence of operations
+
+    Ops ops;        ///< Operations in the order in which they're applied
+
+public:
+    /// Constructs. The default is the identity transformation.
+    ConverterIr() =default;
+
+    /**
+     * Returns the operations of a converter.
+     * @param[in] converter The converter
+     * @return              The operations of the converter. A converter that wasn't built by
+     *                      compile() or isn't linear is a single CALL operation.
+     */
+    static ConverterIr lower(const Converter& converter);
+
+    /**
+     * Appends a linear operation: "y = scale*(x - offset) + intercept".
+     * @param[in] offset    Value subtracted from the input
+     * @param[in] scale     Multiplier of the offset input
+     * @param[in] intercept Value added to the scaled input
+     * @return              A reference to this instance
+     */
+    ConverterIr& linear(const double offset,
+                        const double scale,
+                        const double intercept = 0);
+
+    /**
+     * Appends a logarithm: "y = scale*log(x)".
+     * @param[in] scale     Multiplier of the natural logarithm
+     * @return              A reference to this instance
+     */
+    ConverterIr& log(const double scale);
+
+    /**
+     * Appends an exponential: "y = exp(scale*x)".
+     * @param[in] scale     Multiplier of the input
+     * @return              A reference to this instance
+     */
+    ConverterIr& exp(const double scale);
+
+    /**
+     * Appends the operations of a converter.
+     * @param[in] converter The converter
+     * @return              A reference to this instance
+     * @see lower()
+     */
+    ConverterIr& append(const Converter& converter);
+
+    /**
+     * Replaces the operations with their inverse: the inverse of each operation in reverse order.
+     * The inverse of a LINEAR operation is LINEAR, of LOG is EXP, of EXP is LOG, and of CALL is the
+     * CALL of ConverterImpl::inverse().
+     * @retval false    The inverse of a CALL operation can't be derived. This instance is
+     *                  unmodified.
+     * @retval true     Success
+     */
+    bool invert();
+
+    /**
+     * Simplifies the operations algebraically until no more simplifications apply.
+     * @return A reference to this instance
+     */
+    ConverterIr& simplify();
+
+    /**
+     * Returns the operations.
+     * @return The operations in the order in which they're applied
+     */
+    const Ops& getOps() const;
+
+    /**
+     * Simplifies the operations and returns a converter that executes them. This instance is left
+     * empty.
+     * @return An identity LinearConverter if no operations remain, a LinearConverter if one linear
+     *         operation remains, or a converter that applies the remaining operations in order
+     */
+    Converter compile();
+};
+
+} // namespace quantity
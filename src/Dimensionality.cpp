@@ -23,72 +23,176 @@
 
 #include "Dimensionality.h"
 
+#include "Arena.h"
 #include "Exponent.h"
+#include "Snapshot.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <functional>
-#include <map>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 using namespace std;
 
 namespace quantity {
 
-/// Implementation of dimensionality for a physical quantity.
-class Dimensionality::Impl final
+/**
+ * Implementation of dimensionality for a physical quantity. A dimensionality is a fixed-width
+ * vector of rational exponents indexed by the identifier of each base dimension, so comparing and
+ * hashing instances doesn't touch the base dimensions' names.
+ */
+class Dimensionality::Impl final : public ArenaAllocated<AllocStats::Class::DIMENSIONALITY>
 {
+public:
+    /// Maximum number of base dimensions
+    static constexpr size_t MAX_DIMS = 16;
+    static_assert(MAX_DIMS <= 32, "Bit-mask of dimensions is too small");
+
 private:
     /// Dimension information
     struct DimInfo {
-        const string name;      ///< Name of the dimension
-        const string symbol;    ///< Symbol for the dimension
-        string to_string() const {
-            return symbol;
-        }
-        size_t hash() const {
-            static std::hash<string> myHash;
-            return myHash(name) ^ myHash(symbol);
-        }
+        string name;      ///< Name of the dimension
+        string symbol;    ///< Symbol for the dimension
+    };
+
+    /// Registry of base dimensions
+    struct Registry {
+        vector<DimInfo>               dimInfos;  ///< Base dimension information indexed by ID
+        vector<size_t>                nameOrder; ///< Base dimension identifiers in order of name
+        vector<Pimpl>                 baseDims;  ///< Base dimensions indexed by identifier
+        unordered_map<string, size_t> nameMap;   ///< Name to base dimension identifier map
+        unordered_map<string, size_t> symMap;    ///< Symbol to base dimension identifier map
     };
 
     /**
-     * Compares information on two dimensions
-     * @param[in] info1     Information on the first dimension
-     * @param[in] info2     Information on the second dimension
-     * @retval    true      The first dimension is less than the second
-     * @retval    false     The first dimension in not less than the second
+     * Returns the registry of base dimensions.
+     * @return The registry of base dimensions
      */
-    struct DimInfoLess {
-        bool operator()(const DimInfo& info1, const DimInfo& info2) {
-            return info1.name < info2.name;
-        }
-    };
+    static Snapshot<Registry>& registry()
+    {
+        static Snapshot<Registry> instance;
+        return instance;
+    }
 
-    /// The type of the map from dimension information to exponent
-    using Factors = map<const DimInfo, Exponent, DimInfoLess>;
+    /**
+     * Returns the registered base dimension with a given name and symbol.
+     * @param[in] reg               The registry
+     * @param[in] name              The name of the base dimension
+     * @param[in] symbol            The symbol for the base dimension
+     * @retval    nullptr           No such base dimension exists
+     * @return                      The base dimension
+     * @throw std::invalid_argument The name or symbol is associated with a different base
+     *                              dimension
+     */
+    static Pimpl find(const Registry& reg,
+                      const string&   name,
+                      const string&   symbol)
+    {
+        const auto nameIter = reg.nameMap.find(name);
+        const auto symIter = reg.symMap.find(symbol);
+
+        if (nameIter == reg.nameMap.end() && symIter == reg.symMap.end())
+            return Pimpl{};
 
-    /// The dimensional factors
-    Factors factors;
+        if (nameIter == reg.nameMap.end() || symIter == reg.symMap.end() ||
+                nameIter->second != symIter->second)
+            throw std::invalid_argument("Name \"" + name + "\" or symbol \"" + symbol +
+                    "\" is already associated with a different base dimension");
+
+        return reg.baseDims[nameIter->second];
+    }
+
+    /// Exponents of the base dimensions indexed by identifier. Unused dimensions are zero.
+    Exponent exps[MAX_DIMS];
+    /// Bit `i` is set if and only if the exponent of base dimension `i` is not zero
+    uint32_t nonZero;
+
+    /**
+     * Returns the identifiers of the base dimensions with non-zero exponents in order of increasing
+     * name.
+     * @param[in]  reg  The registry of base dimensions
+     * @param[out] ids  The identifiers
+     * @return          The number of identifiers
+     */
+    size_t namedIds(const Registry& reg,
+                    size_t          ids[MAX_DIMS]) const
+    {
+        size_t n = 0;
+        for (const auto id : reg.nameOrder)
+            if (nonZero & (1u << id))
+                ids[n++] = id;
+        return n;
+    }
 
 public:
-    /// Default constructs.
-    Impl() =default;
+    /// Default constructs a dimensionless instance.
+    Impl()
+        : nonZero(0)
+    {
+        for (auto& exp : exps)
+            exp = Exponent(0);
+    }
 
     /**
-     * Constructs from a dimension and a rational exponent.
-     * @param[in] name      The name of the dimension
-     * @param[in] symbol    The symbol for the dimension
+     * Constructs from a base dimension and a rational exponent.
+     * @param[in] id        The identifier of the base dimension
      * @param[in] exp       The exponent of the dimension. If the exponent is zero, then the
      *                      resulting dimensionality will be empty.
      */
-    Impl(   const string   name,
-            const string   symbol,
+    Impl(   const size_t   id,
             const Exponent exp)
+        : Impl()
     {
+        exps[id] = exp;
         if (!exp.isZero())
-            factors.insert({{name, symbol}, exp});
+            nonZero = 1u << id;
+    }
+
+    /**
+     * Returns a base dimension. Registers it if it doesn't exist. Lookup of an existing base
+     * dimension doesn't lock.
+     * @param[in] name              The name of the base dimension
+     * @param[in] symbol            The symbol for the base dimension
+     * @return                      The base dimension
+     * @throw std::invalid_argument The name or symbol is associated with a different base
+     *                              dimension
+     * @throw std::length_error     There are already MAX_DIMS base dimensions
+     */
+    static Pimpl get(const string& name,
+                     const string& symbol)
+    {
+        auto impl = registry().read([&](const Registry& reg) {
+            return find(reg, name, symbol);
+        });
+        if (impl)
+            return impl;
+
+        return registry().update([&](Registry& reg) {
+            auto impl = find(reg, name, symbol); // Another thread might have added it
+            if (impl)
+                return impl;
+
+            const auto id = reg.dimInfos.size();
+            if (id >= MAX_DIMS)
+                throw std::length_error("Can't have more than " + std::to_string(MAX_DIMS) +
+                        " base dimensions");
+
+            reg.dimInfos.push_back(DimInfo{name, symbol});
+            auto& infos = reg.dimInfos;
+            reg.nameOrder.insert(std::upper_bound(reg.nameOrder.begin(), reg.nameOrder.end(), id,
+                    [&infos](const size_t id1, const size_t id2) {
+                        return infos[id1].name < infos[id2].name;
+                    }), id);
+            reg.baseDims.push_back(Pimpl(new Impl(id, Exponent(1))));
+            reg.nameMap.insert({name, id});
+            reg.symMap.insert({symbol, id});
+            return reg.baseDims.back();
+        });
     }
 
     /**
@@ -97,7 +201,7 @@ public:
      */
 	size_t size() const
 	{
-	    return factors.size();
+	    return __builtin_popcount(nonZero);
 	}
 
 	/**
@@ -108,31 +212,35 @@ public:
 	 */
 	bool isBaseDim() const
 	{
-	    return factors.size() == 1 && factors.begin()->second.isOne();
+	    return size() == 1 && exps[__builtin_ctz(nonZero)].isOne();
 	}
 
     /**
-     * Returns a string representation.
+     * Returns a string representation. Dimensions appear in order of increasing name.
      * @return A string representation
      */
     string to_string() const
     {
-        string rep;
-        bool   haveFactor = false;
-
-        for (auto iter = factors.begin(); iter != factors.end(); ++iter) {
-            if (haveFactor) {
-                rep += "·";
-            }
-            else {
-                haveFactor = true;
+        return registry().read([&](const Registry& reg) {
+            string rep;
+            bool   haveFactor = false;
+            size_t ids[MAX_DIMS];
+            const auto n = namedIds(reg, ids);
+
+            for (size_t i = 0; i < n; ++i) {
+                if (haveFactor) {
+                    rep += "·";
+                }
+                else {
+                    haveFactor = true;
+                }
+                rep += reg.dimInfos[ids[i]].symbol;
+                if (!exps[ids[i]].isOne())
+                    rep += "^" + exps[ids[i]].to_string();
             }
-            rep += iter->first.to_string();
-            if (!iter->second.isOne())
-                rep += "^" + iter->second.to_string();
-        }
 
-        return rep;
+            return rep;
+        });
     }
 
     /**
@@ -141,43 +249,59 @@ public:
      */
     size_t hash() const
     {
-        size_t code = 0;
+        uint64_t words[MAX_DIMS*sizeof(Exponent)/sizeof(uint64_t)];
+        ::memcpy(words, exps, sizeof(words));
 
-        for (auto& factor : factors)
-            code ^= factor.first.hash() ^ factor.second.hash();
+        uint64_t code = nonZero;
+        for (const auto word : words)
+            code = (code ^ word) * 0x100000001b3ULL;  // FNV-1a prime
+        return static_cast<size_t>(code ^ (code >> 32));
+    }
 
-        return code;
+    /**
+     * Indicates if this instance is equal to another.
+     * @param[in] other The other instance
+     * @retval    true  The instances are equal
+     * @retval    false The instances are not equal
+     */
+    bool equals(const Impl& other) const
+    {
+        return nonZero == other.nonZero && ::memcmp(exps, other.exps, sizeof(exps)) == 0;
     }
 
 	/**
-	 * Compares this instance with another instance.
+	 * Compares this instance with another instance. The order is by the name of each dimension,
+	 * then by its exponent, then by the number of dimensions.
 	 * @param[in] other The other instance
 	 * @return          A value less than, equal to, or greater than zero as this instance is
 	 *                  considered less than, equal to, or greater than the other, respectively.
 	 */
 	int compare(const Impl& other) const
 	{
-        auto       iter1 = factors.begin();
-        const auto end1 = factors.end();
-        auto       iter2 = other.factors.begin();
-        const auto end2 = other.factors.end();
-
-        while (iter1 != end1 && iter2 != end2) {
-            auto cmp = iter1->first.name.compare(iter2->first.name);// Primary sort on name
-            if (cmp)
-                return cmp;
-            cmp = iter1->second.compare(iter2->second);             // Secondary sort on exponents
-            if (cmp)
-                return cmp;
-            ++iter1;
-            ++iter2;
-        }
+	    if (equals(other))
+	        return 0;
+
+	    return registry().read([&](const Registry& reg) {
+            size_t     ids1[MAX_DIMS];
+            size_t     ids2[MAX_DIMS];
+            const auto n1 = namedIds(reg, ids1);
+            const auto n2 = other.namedIds(reg, ids2);
+            size_t     i = 0;
+
+            for (; i < n1 && i < n2; ++i) {
+                if (ids1[i] != ids2[i])                             // Primary sort on name
+                    return reg.dimInfos[ids1[i]].name.compare(reg.dimInfos[ids2[i]].name);
+                const auto cmp = exps[ids1[i]].compare(other.exps[ids2[i]]); // Secondary on exps
+                if (cmp)
+                    return cmp;
+            }
 
-        return (iter1 == end1 && iter2 == end2)                 // Tertiary sort on length
-                ? 0
-                : iter1 == end1
-                  ? -1
-                  : 1;
+            return (n1 == n2)                                       // Tertiary sort on length
+                    ? 0
+                    : (i == n1)
+                      ? -1
+                      : 1;
+	    });
 	}
 
     /**
@@ -187,16 +311,16 @@ public:
      */
     Impl* multiply(const Impl& other) const
     {
-        const auto meLarger = size() >= other.size();
-        auto newImpl = new Impl(meLarger ? *this : other);
+        auto newImpl = new Impl(*this);
 
-        for (const auto& factor : (meLarger ? other.factors : factors)) {
-            auto iter = newImpl->factors.find(factor.first);
-            if (iter == newImpl->factors.end()) {
-                newImpl->factors.insert(factor);
+        for (auto bits = other.nonZero; bits; bits &= bits - 1) {
+            const auto id = __builtin_ctz(bits);
+            newImpl->exps[id] = exps[id].add(other.exps[id]);
+            if (newImpl->exps[id].isZero()) {
+                newImpl->nonZero &= ~(1u << id);
             }
             else {
-                iter->second = iter->second.add(factor.second);
+                newImpl->nonZero |= 1u << id;
             }
         }
 
@@ -210,60 +334,47 @@ public:
      */
     Impl* pow(const Exponent& pow) const
     {
+        if (pow.isZero())
+            return new Impl();
+
         auto newImpl = new Impl(*this);
 
-        for (auto& factor : newImpl->factors)
-            factor.second = factor.second.multiply(pow);
+        for (auto bits = nonZero; bits; bits &= bits - 1) {
+            const auto id = __builtin_ctz(bits);
+            newImpl->exps[id] = exps[id].multiply(pow);
+        }
 
         return newImpl;
     }
 };
 
+constexpr size_t Dimensionality::Impl::MAX_DIMS;
+
 Dimensionality::Dimensionality(Impl* impl)
-    : pImpl(impl)
+    : pImpl(impl, default_delete<Impl>(), ArenaAllocator<Impl>()) // Control block from any scope
 {}
 
-Dimensionality::Dimensionality()
-    : pImpl(new Impl())
+Dimensionality::Dimensionality(const Pimpl& impl)
+    : pImpl(impl)
 {}
 
-Dimensionality::Dimensionality(const string&   name,
-                               const string&   symbol,
-                               const Exponent& exp)
-    : pImpl(new Impl(name, symbol, exp))
+Dimensionality::Dimensionality()
+    : Dimensionality(new Impl())
 {}
 
 Dimensionality::Dimensionality(const Dimensionality& other)
-    : pImpl(new Impl(*other.pImpl))
+    : pImpl(other.pImpl) // Instances are immutable
 {}
 
 Dimensionality Dimensionality::get(const string& name,
                                    const string& symbol)
 {
-    static unordered_map<string, Dimensionality> nameMap;  ///< Name to base dimension map
-    static unordered_map<string, Dimensionality> symMap;   ///< Symbol to base dimension map
-
     if (name.size() == 0)
         throw std::invalid_argument("Dimension name is empty");
     if (symbol.size() == 0)
         throw std::invalid_argument("Dimension symbol is empty");
 
-    const auto nameIter = nameMap.find(name);
-    const auto symIter = symMap.find(symbol);
-
-    if (nameIter == nameMap.end() && symIter == symMap.end()) {
-        Dimensionality dim(name, symbol, Exponent(1, 1));
-        nameMap.insert({name, dim});
-        symMap.insert({symbol, dim});
-        return dim;
-    }
-
-    if (nameIter == nameMap.end() || symIter == symMap.end() ||
-            nameIter->second.compare(symIter->second))
-        throw std::invalid_argument("Name \"" + name + "\" or symbol \"" + symbol +
-                "\" is already associated with a different base dimension");
-
-    return nameIter->second;
+    return Dimensionality(Impl::get(name, symbol));
 }
 
 size_t Dimensionality::size() const
@@ -288,7 +399,9 @@ size_t Dimensionality::hash() const
 
 int Dimensionality::compare(const Dimensionality& other) const
 {
-    return pImpl->compare(*other.pImpl);
+    return (pImpl == other.pImpl)
+            ? 0
+            : pImpl->compare(*other.pImpl);
 }
 
 Dimensionality Dimensionality::multiply(const Dimensionality& other) const
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 using namespace std;
 
@@ -51,28 +52,31 @@ protected:
     Dimensionality(Impl* impl);
 
     /**
-     * Constructs from a dimension and a rational exponent.
-     * @param[in] name      The name of the dimension
-     * @param[in] symbol    The symbol for the dimension
-     * @param[in] exp       The dimension's exponent. If it's zero, then the resulting
-     *                      dimensionality will be empty.
+     * Constructs from a shared implementation.
+     * @param impl  Smart pointer to an implementation
      */
-    Dimensionality(const string&   name,
-                   const string&   symbol,
-                   const Exponent& exp);
+    Dimensionality(const Pimpl& impl);
 
 public:
     /// Default constructs. The resulting instance will be empty and have no dimensionality.
     Dimensionality();
 
     /**
-     * Copy constructs.
+     * Copy constructs. Instances are immutable, so the copy shares the implementation.
      * @param[in] other Another instance
      */
     Dimensionality(const Dimensionality& other);
 
     /**
-     * Returns the requested base dimension. Creates it if doesn't exist.
+     * Copy assigns. Instances are immutable, so this instance shares the other's implementation.
+     * @param[in] rhs   The other instance
+     * @return          A reference to this instance
+     */
+    Dimensionality& operator=(const Dimensionality& rhs) =default;
+
+    /**
+     * Returns the requested base dimension. Creates it if doesn't exist. Thread-safe: looking up an
+     * existing base dimension doesn't lock.
      * @param[in] name              The name of the base dimension
      * @param[in] symbol            The symbol for the base dimension
      * @return                      The requested base dimension
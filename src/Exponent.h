@@ -22,41 +22,92 @@
 
 #pragma once
 
-#include <memory>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <stdexcept>
+#include <string>
 
 using namespace std;
 
 namespace quantity {
 
-class ExponentImpl;
-
-/// Implementation of an exponent.
+/**
+ * A rational exponent. Instances are small, trivially-copyable values whose operations don't
+ * allocate, so unit and dimension algebra doesn't touch the heap. The numerator and denominator are
+ * kept in lowest terms with a positive denominator and must each fit in 16 bits.
+ */
 class Exponent
 {
 private:
-    /// Type of smart pointer to an implementation
-    using Pimpl = shared_ptr<ExponentImpl>;
+    int16_t numer;  ///< Exponent numerator
+    int16_t denom;  ///< Exponent denominator. Always positive.
+
+    /**
+     * Returns the greatest common divisor of two integers.
+     * @param[in] n1    One integer
+     * @param[in] n2    Another integer
+     * @return          The greatest common divisor. Always positive unless both are zero.
+     */
+    static constexpr int64_t gcd(int64_t n1, int64_t n2)
+    {
+        n1 = n1 < 0 ? -n1 : n1;
+        n2 = n2 < 0 ? -n2 : n2;
+        while (n2 != 0) {
+            const auto rem = n1 % n2;
+            n1 = n2;
+            n2 = rem;
+        }
+        return n1;
+    }
 
-    /// Smart pointer to an implementation.
-    Pimpl pImpl;
+    /**
+     * Returns the sign of an integer as -1, 0, or 1.
+     * @param[in] i The integer
+     * @return      -1, 0, or 1 for negative, zero, or positive, respectively
+     */
+    static constexpr int sign(const int i)
+    {
+        return (i > 0) - (i < 0);
+    }
 
     /**
-     * Constructs from a pointer to an implementation.
-     * @param[in] impl  Pointer to an implementation
+     * Returns a component of an exponent reduced to lowest terms.
+     * @param[in] n                 The numerator
+     * @param[in] d                 The denominator
+     * @param[in] wantNumer         Whether to return the numerator or the denominator
+     * @return                      The reduced numerator or denominator. The denominator will be
+     *                              positive.
+     * @throw std::invalid_argument The denominator is zero
+     * @throw std::overflow_error   A reduced component doesn't fit in 16 bits
      */
-    Exponent(ExponentImpl* impl);
+    static constexpr int16_t reduce(const int64_t n,
+                                    const int64_t d,
+                                    const bool    wantNumer)
+    {
+        if (d == 0)
+            throw std::invalid_argument("Exponent denominator is zero");
+        const auto div = (d < 0 ? -1 : 1) * gcd(n, d);
+        const auto value = wantNumer ? n/div : d/div;
+        if (value < INT16_MIN || value > INT16_MAX)
+            throw std::overflow_error("Exponent " + std::to_string(n) + "/" + std::to_string(d) +
+                    " is too large");
+        return static_cast<int16_t>(value);
+    }
 
 public:
     /**
      * Constructs from a rational number.
-     * @param[in] numer The numerator of the exponent
-     * @param[in] denom The denominator of the exponent
+     * @param[in] numer                 The numerator of the exponent
+     * @param[in] denom                 The denominator of the exponent
      * @throw     std::invalid_argument The denominator is zero
+     * @throw     std::overflow_error   The reduced numerator or denominator doesn't fit in 16 bits
      */
-    Exponent(int numer = 1,
-             int denom = 1);
+    constexpr Exponent(const int64_t numer = 1,
+                       const int64_t denom = 1)
+        : numer(reduce(numer, denom, true))
+        , denom(reduce(numer, denom, false))
+    {}
 
     /**
      * Returns a string representation.
@@ -69,56 +120,102 @@ public:
      * @retval true     This instance is zero
      * @retval false    This instance is not zero
      */
-    bool isZero() const;
+    constexpr bool isZero() const
+    {
+        return numer == 0;
+    }
 
     /**
      * Indicates if this instance is one.
      * @retval true     This instance is one
      * @retval false    This instance is not one
      */
-    bool isOne() const;
+    constexpr bool isOne() const
+    {
+        return numer == 1 && denom == 1;
+    }
 
     /**
      * Returns the numerator of the exponent.
      * @return The numerator of the exponent
      */
-    int getNumer() const;
+    constexpr int getNumer() const
+    {
+        return numer;
+    }
 
     /**
      * Returns the denominator of the exponent.
      * @return The denominator of the exponent. Will always be positive.
      */
-    int getDenom() const;
+    constexpr int getDenom() const
+    {
+        return denom;
+    }
 
     /**
      * Returns the hash code of this instance.
      * @return The hash code of this instance
      */
-    size_t hash() const;
+    size_t hash() const
+    {
+        return std::hash<uint32_t>()((static_cast<uint32_t>(static_cast<uint16_t>(numer)) << 16) |
+                static_cast<uint16_t>(denom));
+    }
 
     /**
-     * Compares this instance with another.
+     * Compares this instance with another. Zero comes first, then positive exponents in increasing
+     * order, then negative exponents in order of increasing magnitude.
      * @param[in] other The other instance
      * @return          A value less than, equal to, or greater than zero as this instance is
      *                  considered less than, equal to, or greater than the other
      */
-    int compare(const Exponent& other) const;
+    constexpr int compare(const Exponent& other) const
+    {
+        const int s1 = sign(numer);
+        const int s2 = sign(other.numer);
+
+        if (s1 == s2 || (s1 >= 0 && s2 >= 0)) {
+            const int64_t n1 = static_cast<int64_t>(numer)*other.denom;
+            const int64_t n2 = static_cast<int64_t>(other.numer)*denom;
+            const int64_t a1 = n1 < 0 ? -n1 : n1;
+            const int64_t a2 = n2 < 0 ? -n2 : n2;
+            return a1 < a2
+                    ? -1
+                    : a1 == a2
+                      ? 0
+                      : 1;
+        }
+        return (s1 < 0)
+                ? 1
+                : -1;
+    }
 
     /**
      * Multiplies this instance by another instance. This implements raising a unit factor to a
      * power.
      * @param[in] other                 The other instance
      * @return                          This instance multiplied by the given exponent
+     * @throw     std::overflow_error   The result doesn't fit in 16 bits
      */
-    Exponent multiply(const Exponent& other) const;
+    constexpr Exponent multiply(const Exponent& other) const
+    {
+        return Exponent(static_cast<int64_t>(numer)*other.numer,
+                        static_cast<int64_t>(denom)*other.denom);
+    }
 
     /**
      * Adds another instance to this instance. This implements multiplying together two unit factors
      * with the same base unit.
-     * @param[in] other Another instance
-     * @return          This instance after being added to
+     * @param[in] other                 Another instance
+     * @return                          The sum of the two instances
+     * @throw     std::overflow_error   The result doesn't fit in 16 bits
      */
-    Exponent add(const Exponent& other) const;
+    constexpr Exponent add(const Exponent& other) const
+    {
+        return Exponent(static_cast<int64_t>(numer)*other.denom + static_cast<int64_t>(other.numer)*denom,
+                        static_cast<int64_t>(denom)*other.denom);
+    }
 
     /**
      * Raises a value to the power of this instance.
@@ -0,0 +1,133 @@
+/**
+ * This file implements a converter of numeric values whose transformation is linear.
+ *
+ *        File: LinearConverter.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LinearConverter.h"
+#include "Simd.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace quantity {
+
+LinearConverter::LinearConverter(const double offset,
+                                 const double scale,
+                                 const double intercept)
+    : offset(offset)
+    , scale(scale)
+    , intercept(intercept)
+{}
+
+const LinearConverter* LinearConverter::cast(const Converter& converter)
+{
+    return dynamic_cast<const LinearConverter*>(converter.pImpl.get());
+}
+
+bool LinearConverter::isIdentity() const
+{
+    return offset == 0 && scale == 1 && intercept == 0;
+}
+
+double LinearConverter::getOffset() const
+{
+    return offset;
+}
+
+double LinearConverter::getScale() const
+{
+    return scale;
+}
+
+double LinearConverter::getIntercept() const
+{
+    return intercept;
+}
+
+Converter::Pimpl LinearConverter::inverse() const
+{
+    return Converter::Pimpl(new LinearConverter(intercept, 1/scale, offset));
+}
+
+double LinearConverter::operator()(const double value) const
+{
+    return Simd::linear(value, offset, scale, intercept);
+}
+
+void LinearConverter::convert(const double*             in,
+                              double*                   out,
+                              const size_t              n,
+                              const Converter::Accuracy accuracy) const
+{
+    if (isIdentity()) {
+        if (in != out)
+            ::memcpy(out, in, n*sizeof(double));
+    }
+    else {
+        Simd::linear(in, out, n, offset, scale, intercept);
+    }
+}
+
+void LinearConverter::convert(const void*               in,
+                              const size_t              inStride,
+                              void*                     out,
+                              const size_t              outStride,
+                              const size_t              n,
+                              const Converter::Accuracy accuracy) const
+{
+    auto inBytes = static_cast<const char*>(in);
+    auto outBytes = static_cast<char*>(out);
+    for (size_t i = 0; i < n; ++i, inBytes += inStride, outBytes += outStride) {
+        double value;
+        ::memcpy(&value, inBytes, sizeof(value)); // The values needn't be aligned
+        value = Simd::linear(value, offset, scale, intercept);
+        ::memcpy(outBytes, &value, sizeof(value));
+    }
+}
+
+void LinearConverter::convert(const float*                    in,
+                              float*                          out,
+                              const size_t                    n,
+                              const Converter::Accuracy       accuracy,
+                              const Converter::FloatPrecision precision) const
+{
+    if (isIdentity()) {
+        if (in != out)
+            ::memcpy(out, in, n*sizeof(float));
+    }
+    else if (precision == Converter::FloatPrecision::SINGLE) {
+        Simd::linearSingle(in, out, n, static_cast<float>(offset), static_cast<float>(scale),
+                static_cast<float>(intercept));
+    }
+    else {
+        Simd::linearMixed(in, out, n, offset, scale, intercept);
+    }
+}
+
+void LinearConverter::convert(const float*              in,
+                              double*                   out,
+                              const size_t              n,
+                              const Converter::Accuracy accuracy) const
+{
+    Simd::linearWidening(in, out, n, offset, scale, intercept);
+}
+
+} // namespace quantity
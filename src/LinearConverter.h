@@ -0,0 +1,162 @@
+/**
+ * This file declares a converter of numeric values whose transformation is linear (i.e., has the form
+ * "y = a*x + b").
+ *
+ *        File: LinearConverter.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Converter.h"
+#include "ConverterImpl.h"
+
+namespace quantity {
+
+/**
+ * A linear converter of numeric values. The transformation is "y = scale*(x - offset) + intercept".
+ * The input offset is kept separate from the output intercept so that the conversion out of an
+ * affine unit (i.e., "(x - b)/a") doesn't suffer the cancellation error of "(1/a)*x - b/a". The
+ * composition of two linear converters is a linear converter, so ConverterIr folds any chain of
+ * affine and trivial conversions into a single instance.
+ */
+class LinearConverter final : public ConverterImpl
+{
+private:
+    double offset;      ///< Value subtracted from the input
+    double scale;       ///< Multiplier of the offset input
+    double intercept;   ///< Value added to the scaled input
+
+public:
+    /**
+     * Constructs. The default is the identity transformation.
+     * @param[in] offset    Value subtracted from the input
+     * @param[in] scale     Multiplier of the offset input
+     * @param[in] intercept Value added to the scaled input
+     */
+    LinearConverter(const double offset = 0,
+                    const double scale = 1,
+                    const double intercept = 0);
+
+    /**
+     * Returns the linear implementation of a converter.
+     * @param[in] converter The converter
+     * @retval    nullptr   The converter's implementation isn't linear
+     * @return              The converter's linear implementation
+     */
+    static const LinearConverter* cast(const Converter& converter);
+
+    /**
+     * Indicates if this instance is the identity transformation.
+     * @retval true     This instance is the identity transformation
+     * @retval false    This instance is not the identity transformation
+     */
+    bool isIdentity() const;
+
+    /**
+     * Returns the value subtracted from the input.
+     * @return The value subtracted from the input
+     */
+    double getOffset() const;
+
+    /**
+     * Returns the multiplier of the offset input.
+     * @return The multiplier of the offset input
+     */
+    double getScale() const;
+
+    /**
+     * Returns the value added to the scaled input.
+     * @return The value added to the scaled input
+     */
+    double getIntercept() const;
+
+    /**
+     * Returns the inverse of this instance: "x = (y - intercept)/scale + offset".
+     * @return The inverse of this instance
+     */
+    Converter::Pimpl inverse() const override;
+
+    /**
+     * Converts a numeric value in the input unit to the equivalent value in the output unit.
+     * @param[in] value     The numeric value in the input unit
+     * @return              The equivalent numeric value in the output unit
+     */
+    double operator()(const double value) const override;
+
+    /**
+     * Converts an array of numeric values in the input unit to the equivalent values in the output
+     * unit.
+     * @param[in]  in       The numeric values in the input unit
+     * @param[out] out      The equivalent numeric values in the output unit
+     * @param[in]  n        The number of values
+     * @param[in]  accuracy Ignored: the transformation has no logarithms or exponentials
+     */
+    void convert(const double*             in,
+                 double*                   out,
+                 const size_t              n,
+                 const Converter::Accuracy accuracy) const override;
+
+    /**
+     * Converts numeric values in the input unit that are evenly spaced in memory to the equivalent
+     * values in the output unit. The values are converted directly rather than through a buffer.
+     * @param[in]  in           First numeric value in the input unit. Needn't be aligned.
+     * @param[in]  inStride     Number of bytes from one input value to the next
+     * @param[out] out          First equivalent numeric value in the output unit. Needn't be
+     *                          aligned.
+     * @param[in]  outStride    Number of bytes from one output value to the next
+     * @param[in]  n            The number of values
+     * @param[in]  accuracy     Ignored: the transformation has no logarithms or exponentials
+     */
+    void convert(const void*               in,
+                 const size_t              inStride,
+                 void*                     out,
+                 const size_t              outStride,
+                 const size_t              n,
+                 const Converter::Accuracy accuracy) const override;
+
+    /**
+     * Converts an array of single-precision numeric values in the input unit to the equivalent
+     * values in the output unit with vectorized kernels.
+     * @param[in]  in        The numeric values in the input unit
+     * @param[out] out       The equivalent numeric values in the output unit
+     * @param[in]  n         The number of values
+     * @param[in]  accuracy  Ignored: the transformation has no logarithms or exponentials
+     * @param[in]  precision Whether the arithmetic is in single or double precision
+     */
+    void convert(const float*                    in,
+                 float*                          out,
+                 const size_t                    n,
+                 const Converter::Accuracy       accuracy,
+                 const Converter::FloatPrecision precision) const override;
+
+    /**
+     * Converts an array of single-precision numeric values in the input unit to the equivalent
+     * double-precision values in the output unit with a vectorized kernel.
+     * @param[in]  in       The numeric values in the input unit
+     * @param[out] out      The equivalent numeric values in the output unit
+     * @param[in]  n        The number of values
+     * @param[in]  accuracy Ignored: the transformation has no logarithms or exponentials
+     */
+    void convert(const float*              in,
+                 double*                   out,
+                 const size_t              n,
+                 const Converter::Accuracy accuracy) const override;
+};
+
+} // namespace quantity
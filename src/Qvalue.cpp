@@ -0,0 +1,283 @@
+/**
+ * This file implements a numeric value together with its unit.
+ *
+ *        File: Qvalue.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Qvalue.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+using namespace std;
+
+namespace quantity {
+
+static_assert(sizeof(Qvalue) == 16, "Qvalue isn't 16 bytes");
+
+/**
+ * A reference-counted handle to a unit. There's at most one handle per unit object, so instances
+ * whose units are equal share a handle. Handles are kept in a process-wide table that's divided
+ * into shards by unit, each with its own lock, so finding or adding a handle neither copies the
+ * table nor contends with threads using other units. A handle whose count has reached zero is
+ * never revived: it's replaced in the table if necessary, and it's destroyed by the thread that
+ * released its last reference after that thread has removed it from the table.
+ */
+class Qvalue::Handle final
+{
+    /// A part of the table of handles. Aligned to a cache line so that shards don't share one.
+    struct alignas(64) Shard final
+    {
+        mutex                               lock;       ///< Protects this instance
+        unordered_map<const Unit*, Handle*> handles;    ///< Handles indexed by unit
+    };
+
+    /**
+     * Returns the shard of a unit.
+     * @param[in] unit  The unit
+     * @return          The shard of the unit
+     */
+    static Shard& getShard(const Unit* unit)
+    {
+        static constexpr unsigned SHARD_BITS = 4;   // Base-2 logarithm of the number of shards
+        static Shard              shards[1 << SHARD_BITS];
+
+        // Fibonacci hashing of the address
+        const auto index = (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(unit))*
+                UINT64_C(0x9E3779B97F4A7C15)) >> (64 - SHARD_BITS);
+        return shards[index];
+    }
+
+    const Unit::Pimpl           unit;   ///< The unit
+    Shard&                      shard;  ///< The shard containing this instance
+    mutable std::atomic<size_t> refs;   ///< Number of references
+
+    /**
+     * Constructs. The instance has one reference.
+     * @param[in] unit   The unit
+     * @param[in] shard  The shard that will contain the instance
+     */
+    Handle(const Unit::Pimpl& unit,
+           Shard&             shard)
+        : unit(unit)
+        , shard(shard)
+        , refs(1)
+    {}
+
+public:
+    /**
+     * Returns a reference to the handle of a unit. The handle is created if necessary.
+     * @param[in] unit              The unit
+     * @return                      The handle of the unit. The caller must release it.
+     * @throw std::invalid_argument The unit is null
+     */
+    static const Handle* get(const Unit::Pimpl& unit)
+    {
+        if (!unit)
+            throw invalid_argument("Unit is null");
+
+        // A unit isn't destroyed while its handle exists, so its address identifies it
+        const auto        key = unit.get();
+        auto&             shard = getShard(key);
+        lock_guard<mutex> guard{shard.lock};
+        const auto        iter = shard.handles.find(key);
+        if (iter != shard.handles.end() && iter->second->tryAcquire())
+            return iter->second;
+        // An existing entry's handle is being destroyed by another thread and is replaced
+        unique_ptr<Handle> handle{new Handle(unit, shard)};
+        shard.handles[key] = handle.get();
+        return handle.release();
+    }
+
+    /**
+     * Adds a reference if this instance isn't being destroyed.
+     * @pre             The lock of the shard is held
+     * @retval true     A reference was added
+     * @retval false    The count is zero: this instance is being destroyed
+     */
+    bool tryAcquire() const noexcept
+    {
+        auto count = refs.load(memory_order_relaxed);
+        while (count)
+            if (refs.compare_exchange_weak(count, count + 1, memory_order_relaxed))
+                return true;
+        return false;
+    }
+
+    /// Adds a reference. The caller must already have one.
+    void acquire() const noexcept
+    {
+        refs.fetch_add(1, memory_order_relaxed);
+    }
+
+    /// Removes a reference. Destroys this instance if it was the last one.
+    void release() const noexcept
+    {
+        if (refs.fetch_sub(1, memory_order_acq_rel) != 1)
+            return;
+
+        {
+            lock_guard<mutex> guard{shard.lock};
+            const auto        iter = shard.handles.find(unit.get());
+            if (iter != shard.handles.end() && iter->second == this)
+                shard.handles.erase(iter); // Not replaced by get()
+        }
+        delete this;
+    }
+
+    /**
+     * Returns the unit.
+     * @return The unit
+     */
+    const Unit::Pimpl& getUnit() const noexcept
+    {
+        return unit;
+    }
+};
+
+Qvalue::Qvalue(const double  value,
+               const Handle* unit) noexcept
+    : value(value)
+    , unit(unit)
+{
+    unit->acquire();
+}
+
+Qvalue::Qvalue(const double       value,
+               const Unit::Pimpl& unit)
+    : value(value)
+    , unit(Handle::get(unit))
+{}
+
+Qvalue::Qvalue(const Qvalue& other) noexcept
+    : Qvalue(other.value, other.unit)
+{}
+
+Qvalue::~Qvalue() noexcept
+{
+    unit->release();
+}
+
+Qvalue& Qvalue::operator=(const Qvalue& rhs) noexcept
+{
+    rhs.unit->acquire(); // First, in case of self-assignment
+    unit->release();
+    value = rhs.value;
+    unit = rhs.unit;
+    return *this;
+}
+
+Qvalue& Qvalue::operator=(Qvalue&& rhs) noexcept
+{
+    value = rhs.value;
+    std::swap(unit, rhs.unit);
+    return *this;
+}
+
+const Unit::Pimpl& Qvalue::getUnit() const noexcept
+{
+    return unit->getUnit();
+}
+
+double Qvalue::valueOf(const Qvalue& other) const
+{
+    return (other.unit == unit)
+            ? other.value
+            : Unit::getConverter(other.getUnit(), getUnit())(other.value);
+}
+
+Qvalue Qvalue::convertTo(const Unit::Pimpl& unit) const
+{
+    return (unit.get() == getUnit().get())
+            ? *this
+            : Qvalue(Unit::getConverter(getUnit(), unit)(value), unit);
+}
+
+string Qvalue::to_string() const
+{
+    ostringstream stream;
+    stream << *this;
+    return stream.str();
+}
+
+Qvalue Qvalue::operator+(const Qvalue& rhs) const
+{
+    return Qvalue(value + valueOf(rhs), unit);
+}
+
+Qvalue Qvalue::operator-(const Qvalue& rhs) const
+{
+    return Qvalue(value - valueOf(rhs), unit);
+}
+
+Qvalue Qvalue::operator*(const Qvalue& rhs) const
+{
+    return Qvalue(value*rhs.value, getUnit()->multiply(rhs.getUnit()));
+}
+
+Qvalue Qvalue::operator/(const Qvalue& rhs) const
+{
+    return Qvalue(value/rhs.value, getUnit()->divideBy(rhs.getUnit()));
+}
+
+Qvalue Qvalue::operator*(const double factor) const noexcept
+{
+    return Qvalue(value*factor, unit);
+}
+
+Qvalue Qvalue::operator/(const double divisor) const noexcept
+{
+    return Qvalue(value/divisor, unit);
+}
+
+Qvalue& Qvalue::operator+=(const Qvalue& rhs)
+{
+    value += valueOf(rhs);
+    return *this;
+}
+
+Qvalue& Qvalue::operator-=(const Qvalue& rhs)
+{
+    value -= valueOf(rhs);
+    return *this;
+}
+
+bool Qvalue::operator==(const Qvalue& rhs) const
+{
+    return value == valueOf(rhs);
+}
+
+bool Qvalue::operator<(const Qvalue& rhs) const
+{
+    return value < valueOf(rhs);
+}
+
+ostream& operator<<(ostream& ostream, const Qvalue& qvalue)
+{
+    return ostream << qvalue.getValue() << ' ' << qvalue.getUnit()->to_string();
+}
+
+} // namespace quantity
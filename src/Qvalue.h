@@ -0,0 +1,246 @@
+/**
+ * This file declares a numeric value together with its unit.
+ *
+ *        File: Qvalue.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Unit.h"
+
+#include <iosfwd>
+#include <string>
+
+namespace quantity {
+
+/**
+ * A numeric value together with its unit (e.g., 0.5 meters). An instance is 16 bytes: the value and
+ * a pointer to the handle of the interned unit. Because equal units share a handle, arithmetic on
+ * values in the same unit is plain floating-point arithmetic; only values in different units are
+ * converted, via the process-wide converter cache. Handles are reference counted: copying an
+ * instance increments its handle's count, and a handle and its reference to the unit are destroyed
+ * with the last instance that refers to it.
+ * @threadsafety Compatible
+ */
+class Qvalue final
+{
+public:
+    class Handle;
+
+private:
+    double        value;  ///< Numeric value in units of @ unit
+    const Handle* unit;   ///< Handle of the interned unit. Counts this instance.
+
+    /**
+     * Constructs from a value and a handle. Adds a reference to the handle.
+     * @param[in] value     The numeric value
+     * @param[in] unit      The handle
+     */
+    Qvalue(const double  value,
+           const Handle* unit) noexcept;
+
+    /**
+     * Returns the numeric value of another instance in this instance's unit.
+     * @param[in] other             The other instance
+     * @return                      The numeric value of @ other in this instance's unit
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    double valueOf(const Qvalue& other) const;
+
+public:
+    /**
+     * Constructs.
+     * @param[in] value             The numeric value
+     * @param[in] unit              The unit of the value
+     * @throw std::invalid_argument The unit is null
+     */
+    Qvalue(const double       value,
+           const Unit::Pimpl& unit);
+
+    /**
+     * Copy constructs. Adds a reference to the other instance's handle.
+     * @param[in] other The other instance
+     */
+    Qvalue(const Qvalue& other) noexcept;
+
+    /// Destroys. Removes a reference to the handle.
+    ~Qvalue() noexcept;
+
+    /**
+     * Copy assigns.
+     * @param[in] rhs   The other instance
+     * @return          A reference to this instance
+     */
+    Qvalue& operator=(const Qvalue& rhs) noexcept;
+
+    /**
+     * Move assigns. The instances exchange handles, so no reference count changes.
+     * @param[in] rhs   The other instance
+     * @return          A reference to this instance
+     */
+    Qvalue& operator=(Qvalue&& rhs) noexcept;
+
+    /**
+     * Returns the numeric value.
+     * @return The numeric value
+     */
+    double getValue() const noexcept
+    {
+        return value;
+    }
+
+    /**
+     * Returns the unit.
+     * @return The unit
+     */
+    const Unit::Pimpl& getUnit() const noexcept;
+
+    /**
+     * Indicates if this instance has the same unit as another.
+     * @param[in] other The other instance
+     * @retval true     The units are equal
+     * @retval false    The units aren't equal
+     */
+    bool sameUnit(const Qvalue& other) const noexcept
+    {
+        return unit == other.unit;
+    }
+
+    /**
+     * Returns this instance in a different unit.
+     * @param[in] unit              The unit of the result
+     * @return                      This instance in the given unit
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    Qvalue convertTo(const Unit::Pimpl& unit) const;
+
+    /**
+     * Returns the string representation.
+     * @return The string representation (e.g., "0.5 m")
+     */
+    std::string to_string() const;
+
+    /**
+     * Adds another instance.
+     * @param[in] rhs               The other instance. Converted to this instance's unit if
+     *                              necessary.
+     * @return                      The sum in this instance's unit
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    Qvalue operator+(const Qvalue& rhs) const;
+
+    /**
+     * Subtracts another instance.
+     * @param[in] rhs               The other instance. Converted to this instance's unit if
+     *                              necessary.
+     * @return                      The difference in this instance's unit
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    Qvalue operator-(const Qvalue& rhs) const;
+
+    /**
+     * Multiplies by another instance.
+     * @param[in] rhs           The other instance
+     * @return                  The product in the product of the units
+     * @throw std::logic_error  The units can't be multiplied
+     */
+    Qvalue operator*(const Qvalue& rhs) const;
+
+    /**
+     * Divides by another instance.
+     * @param[in] rhs           The other instance
+     * @return                  The quotient in the quotient of the units
+     * @throw std::logic_error  The units can't be divided
+     */
+    Qvalue operator/(const Qvalue& rhs) const;
+
+    /**
+     * Multiplies by a number.
+     * @param[in] factor    The number
+     * @return              The product in this instance's unit
+     */
+    Qvalue operator*(const double factor) const noexcept;
+
+    /**
+     * Divides by a number.
+     * @param[in] divisor   The number
+     * @return              The quotient in this instance's unit
+     */
+    Qvalue operator/(const double divisor) const noexcept;
+
+    /**
+     * Adds another instance to this one.
+     * @param[in] rhs               The other instance. Converted to this instance's unit if
+     *                              necessary.
+     * @return                      A reference to this instance
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    Qvalue& operator+=(const Qvalue& rhs);
+
+    /**
+     * Subtracts another instance from this one.
+     * @param[in] rhs               The other instance. Converted to this instance's unit if
+     *                              necessary.
+     * @return                      A reference to this instance
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    Qvalue& operator-=(const Qvalue& rhs);
+
+    /**
+     * Indicates if this instance is equal to another.
+     * @param[in] rhs               The other instance. Converted to this instance's unit if
+     *                              necessary.
+     * @retval true                 The instances are equal
+     * @retval false                The instances aren't equal
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    bool operator==(const Qvalue& rhs) const;
+
+    /**
+     * Indicates if this instance is less than another.
+     * @param[in] rhs               The other instance. Converted to this instance's unit if
+     *                              necessary.
+     * @retval true                 This instance is less than the other
+     * @retval false                This instance isn't less than the other
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    bool operator<(const Qvalue& rhs) const;
+};
+
+/**
+ * Multiplies a number by an instance.
+ * @param[in] factor    The number
+ * @param[in] qvalue    The instance
+ * @return              The product in the instance's unit
+ */
+inline Qvalue operator*(const double  factor,
+                        const Qvalue& qvalue) noexcept
+{
+    return qvalue*factor;
+}
+
+/**
+ * Writes an instance to an output stream.
+ * @param[in,out] ostream   The output stream
+ * @param[in]     qvalue    The instance
+ * @return                  The output stream
+ */
+std::ostream& operator<<(std::ostream& ostream, const Qvalue& qvalue);
+
+} // namespace quantity
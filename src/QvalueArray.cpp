@@ -0,0 +1,216 @@
+/**
+ * This file implements an array of numeric values that share a unit.
+ *
+ *        File: QvalueArray.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QvalueArray.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+namespace quantity {
+
+/// Number of values converted at a time when the operands of an operation have different units
+static constexpr size_t CHUNK_SIZE = 256;
+
+/**
+ * Vets a unit.
+ * @param[in] unit              The unit
+ * @return                      The unit
+ * @throw std::invalid_argument The unit is null
+ */
+static const Unit::Pimpl& vet(const Unit::Pimpl& unit)
+{
+    if (!unit)
+        throw invalid_argument("Unit is null");
+    return unit;
+}
+
+/**
+ * Vets the sizes of two arrays that are operands of an element-wise operation.
+ * @param[in] lhs               The left array
+ * @param[in] rhs               The right array
+ * @throw std::invalid_argument The arrays have different sizes
+ */
+static void vetSizes(const QvalueArray& lhs,
+                     const QvalueArray& rhs)
+{
+    if (lhs.size() != rhs.size())
+        throw invalid_argument("Arrays have different sizes: " + std::to_string(lhs.size()) +
+                " and " + std::to_string(rhs.size()));
+}
+
+QvalueArray::QvalueArray(const Unit::Pimpl& unit,
+                         const size_t       n,
+                         const double       value)
+    : values(n, value)
+    , unit(vet(unit))
+{}
+
+QvalueArray::QvalueArray(const Unit::Pimpl& unit,
+                         const double*      values,
+                         const size_t       n)
+    : values(values, values + n)
+    , unit(vet(unit))
+{}
+
+QvalueArray::QvalueArray(const Unit::Pimpl&    unit,
+                         std::vector<double>&& values)
+    : values(std::move(values))
+    , unit(vet(unit))
+{}
+
+template<typename Op>
+void QvalueArray::apply(const QvalueArray& rhs, Op op)
+{
+    vetSizes(*this, rhs);
+    const auto n = values.size();
+    auto       lhs = values.data();
+
+    if (rhs.unit.get() == unit.get()) {
+        const auto in = rhs.values.data();
+        for (size_t i = 0; i < n; ++i)
+            op(lhs[i], in[i]);
+        return;
+    }
+
+    const auto converter = Unit::getConverter(rhs.unit, unit);
+    double     buf[CHUNK_SIZE];
+    for (size_t start = 0; start < n; start += CHUNK_SIZE) {
+        const auto count = std::min(CHUNK_SIZE, n - start);
+        converter.convert(rhs.values.data() + start, buf, count);
+        for (size_t i = 0; i < count; ++i)
+            op(lhs[start + i], buf[i]);
+    }
+}
+
+Qvalue QvalueArray::at(const size_t i) const
+{
+    return Qvalue(values.at(i), unit);
+}
+
+void QvalueArray::push_back(const Qvalue& value)
+{
+    values.push_back(value.getUnit().get() == unit.get()
+            ? value.getValue()
+            : Unit::getConverter(value.getUnit(), unit)(value.getValue()));
+}
+
+std::vector<double> QvalueArray::release() noexcept
+{
+    std::vector<double> result;
+    result.swap(values);
+    return result;
+}
+
+QvalueArray& QvalueArray::convertTo(const Unit::Pimpl& unit)
+{
+    if (vet(unit).get() != this->unit.get()) {
+        Unit::getConverter(this->unit, unit).convert(values.data(), values.size());
+        this->unit = unit;
+    }
+    return *this;
+}
+
+QvalueArray& QvalueArray::operator+=(const QvalueArray& rhs)
+{
+    apply(rhs, [](double& lhs, const double rhs) { lhs += rhs; });
+    return *this;
+}
+
+QvalueArray& QvalueArray::operator-=(const QvalueArray& rhs)
+{
+    apply(rhs, [](double& lhs, const double rhs) { lhs -= rhs; });
+    return *this;
+}
+
+QvalueArray& QvalueArray::operator*=(const QvalueArray& rhs)
+{
+    vetSizes(*this, rhs);
+    auto       product = unit->multiply(rhs.unit); // Before modification in case it throws
+    const auto n = values.size();
+    auto       lhs = values.data();
+    const auto in = rhs.values.data();
+    for (size_t i = 0; i < n; ++i)
+        lhs[i] *= in[i];
+    unit = std::move(product);
+    return *this;
+}
+
+QvalueArray& QvalueArray::operator/=(const QvalueArray& rhs)
+{
+    vetSizes(*this, rhs);
+    auto       quotient = unit->divideBy(rhs.unit); // Before modification in case it throws
+    const auto n = values.size();
+    auto       lhs = values.data();
+    const auto in = rhs.values.data();
+    for (size_t i = 0; i < n; ++i)
+        lhs[i] /= in[i];
+    unit = std::move(quotient);
+    return *this;
+}
+
+QvalueArray& QvalueArray::operator*=(const double factor) noexcept
+{
+    for (auto& value : values)
+        value *= factor;
+    return *this;
+}
+
+QvalueArray& QvalueArray::operator/=(const double divisor) noexcept
+{
+    for (auto& value : values)
+        value /= divisor;
+    return *this;
+}
+
+Qvalue QvalueArray::sum() const
+{
+    double sum = 0;
+    for (const auto value : values)
+        sum += value;
+    return Qvalue(sum, unit);
+}
+
+Qvalue QvalueArray::mean() const
+{
+    if (values.empty())
+        throw out_of_range("Mean of empty array");
+    return sum()/static_cast<double>(values.size());
+}
+
+Qvalue QvalueArray::min() const
+{
+    if (values.empty())
+        throw out_of_range("Minimum of empty array");
+    return Qvalue(*std::min_element(values.begin(), values.end()), unit);
+}
+
+Qvalue QvalueArray::max() const
+{
+    if (values.empty())
+        throw out_of_range("Maximum of empty array");
+    return Qvalue(*std::max_element(values.begin(), values.end()), unit);
+}
+
+} // namespace quantity
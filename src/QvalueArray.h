@@ -0,0 +1,362 @@
+/**
+ * This file declares an array of numeric values that share a unit.
+ *
+ *        File: QvalueArray.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Qvalue.h"
+#include "QvalueExpr.h"
+#include "Unit.h"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace quantity {
+
+/**
+ * An array of numeric values that share a single unit (e.g., a column of data). The values are
+ * stored contiguously, so they can be passed to code that takes a pointer and a length without
+ * being copied. Values in different units are converted in bulk by Converter::convert().
+ *
+ * Like Qvalue, addition and subtraction convert the right operand to the left operand's unit;
+ * multiplication and division combine the units. The binary arithmetic operators are lazy: they
+ * return an expression (see QvalueExpr) that's evaluated in a single pass when it's assigned to an
+ * instance.
+ * @threadsafety Compatible
+ */
+class QvalueArray final : public QvalueExpr<QvalueArray>
+{
+    std::vector<double> values; ///< Numeric values in units of @ unit
+    Unit::Pimpl         unit;   ///< Unit of the values
+
+    /**
+     * Applies a binary operation element-wise with another array, whose values are first converted
+     * to this array's unit if necessary.
+     * @param[in] rhs               The other array
+     * @param[in] op                The operation: `void op(double& lhs, double rhs)`
+     * @throw std::invalid_argument The arrays have different sizes or the units aren't convertible
+     */
+    template<typename Op>
+    void apply(const QvalueArray& rhs, Op op);
+
+public:
+    /// Whether this type is a scalar expression
+    static constexpr bool scalar = false;
+
+    /**
+     * Constructs.
+     * @param[in] unit              The unit of the values
+     * @param[in] n                 The number of values
+     * @param[in] value             The initial value of each element
+     * @throw std::invalid_argument The unit is null
+     */
+    explicit QvalueArray(const Unit::Pimpl& unit,
+                         const size_t       n = 0,
+                         const double       value = 0);
+
+    /**
+     * Constructs from a copy of an array of values.
+     * @param[in] unit              The unit of the values
+     * @param[in] values            The values
+     * @param[in] n                 The number of values
+     * @throw std::invalid_argument The unit is null
+     */
+    QvalueArray(const Unit::Pimpl& unit,
+                const double*      values,
+                const size_t       n);
+
+    /**
+     * Constructs from a vector of values without copying them.
+     * @param[in] unit              The unit of the values
+     * @param[in] values            The values. Moved into this instance.
+     * @throw std::invalid_argument The unit is null
+     */
+    QvalueArray(const Unit::Pimpl&    unit,
+                std::vector<double>&& values);
+
+    /**
+     * Constructs by evaluating an expression. Each element is computed in a single pass.
+     * @param[in] expr  The expression
+     */
+    template<typename E>
+    QvalueArray(const QvalueExpr<E>& expr)
+        : values(expr.self().size())
+        , unit(expr.self().getUnit())
+    {
+        expr::evaluate(expr.self(), values.data());
+    }
+
+    /**
+     * Assigns the evaluation of an expression. Each element is computed in a single pass. The
+     * expression may refer to this instance.
+     * @param[in] expr  The expression
+     * @return          A reference to this instance
+     */
+    template<typename E>
+    QvalueArray& operator=(const QvalueExpr<E>& expr)
+    {
+        const auto& e = expr.self();
+        auto        unit = e.getUnit(); // Before modification because `e` may refer to `this`
+        values.resize(e.size());
+        expr::evaluate(e, values.data());
+        this->unit = std::move(unit);
+        return *this;
+    }
+
+    /**
+     * Returns the unit.
+     * @return The unit of the values
+     */
+    const Unit::Pimpl& getUnit() const noexcept
+    {
+        return unit;
+    }
+
+    /**
+     * Returns the number of values.
+     * @return The number of values
+     */
+    size_t size() const noexcept
+    {
+        return values.size();
+    }
+
+    /**
+     * Indicates if there are no values.
+     * @retval true     There are no values
+     * @retval false    There are values
+     */
+    bool empty() const noexcept
+    {
+        return values.empty();
+    }
+
+    /**
+     * Returns a pointer to the contiguous values.
+     * @return A pointer to the first value. Valid until the size changes.
+     */
+    double* data() noexcept
+    {
+        return values.data();
+    }
+
+    /**
+     * Returns a pointer to the contiguous values.
+     * @return A pointer to the first value. Valid until the size changes.
+     */
+    const double* data() const noexcept
+    {
+        return values.data();
+    }
+
+    /// Returns a pointer to the first value.
+    double* begin() noexcept
+    {
+        return values.data();
+    }
+
+    /// Returns a pointer to one past the last value.
+    double* end() noexcept
+    {
+        return values.data() + values.size();
+    }
+
+    /// Returns a pointer to the first value.
+    const double* begin() const noexcept
+    {
+        return values.data();
+    }
+
+    /// Returns a pointer to one past the last value.
+    const double* end() const noexcept
+    {
+        return values.data() + values.size();
+    }
+
+    /**
+     * Returns a reference to a value.
+     * @param[in] i The index of the value. Not checked.
+     * @return      A reference to the value
+     */
+    double& operator[](const size_t i) noexcept
+    {
+        return values[i];
+    }
+
+    /**
+     * Returns a value.
+     * @param[in] i The index of the value. Not checked.
+     * @return      The value
+     */
+    double operator[](const size_t i) const noexcept
+    {
+        return values[i];
+    }
+
+    /**
+     * Returns an element together with the unit.
+     * @param[in] i             The index of the element
+     * @return                  The element
+     * @throw std::out_of_range The index is out of range
+     */
+    Qvalue at(const size_t i) const;
+
+    /**
+     * Appends a value.
+     * @param[in] value The value in this instance's unit
+     */
+    void push_back(const double value)
+    {
+        values.push_back(value);
+    }
+
+    /**
+     * Appends a value, converting it to this instance's unit if necessary.
+     * @param[in] value             The value
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    void push_back(const Qvalue& value);
+
+    /**
+     * Releases the values without copying them. This instance is left empty.
+     * @return The values
+     */
+    std::vector<double> release() noexcept;
+
+    /**
+     * Converts the values in place to a different unit.
+     * @param[in] unit              The new unit
+     * @return                      A reference to this instance
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    QvalueArray& convertTo(const Unit::Pimpl& unit);
+
+    /**
+     * Adds another array element-wise.
+     * @param[in] rhs               The other array. Its values are converted to this instance's
+     *                              unit if necessary.
+     * @return                      A reference to this instance
+     * @throw std::invalid_argument The arrays have different sizes or the units aren't convertible
+     */
+    QvalueArray& operator+=(const QvalueArray& rhs);
+
+    /**
+     * Subtracts another array element-wise.
+     * @param[in] rhs               The other array. Its values are converted to this instance's
+     *                              unit if necessary.
+     * @return                      A reference to this instance
+     * @throw std::invalid_argument The arrays have different sizes or the units aren't convertible
+     */
+    QvalueArray& operator-=(const QvalueArray& rhs);
+
+    /**
+     * Multiplies by another array element-wise.
+     * @param[in] rhs               The other array
+     * @return                      A reference to this instance, whose unit is the product of the
+     *                              units
+     * @throw std::invalid_argument The arrays have different sizes
+     * @throw std::logic_error      The units can't be multiplied
+     */
+    QvalueArray& operator*=(const QvalueArray& rhs);
+
+    /**
+     * Divides by another array element-wise.
+     * @param[in] rhs               The other array
+     * @return                      A reference to this instance, whose unit is the quotient of the
+     *                              units
+     * @throw std::invalid_argument The arrays have different sizes
+     * @throw std::logic_error      The units can't be divided
+     */
+    QvalueArray& operator/=(const QvalueArray& rhs);
+
+    /**
+     * Multiplies every value by a number.
+     * @param[in] factor    The number
+     * @return              A reference to this instance
+     */
+    QvalueArray& operator*=(const double factor) noexcept;
+
+    /**
+     * Divides every value by a number.
+     * @param[in] divisor   The number
+     * @return              A reference to this instance
+     */
+    QvalueArray& operator/=(const double divisor) noexcept;
+
+    /**
+     * Returns the sum of the values.
+     * @return The sum in this instance's unit. Zero if there are no values.
+     */
+    Qvalue sum() const;
+
+    /**
+     * Returns the arithmetic mean of the values.
+     * @return                  The mean in this instance's unit
+     * @throw std::out_of_range There are no values
+     */
+    Qvalue mean() const;
+
+    /**
+     * Returns the smallest value.
+     * @return                  The smallest value in this instance's unit
+     * @throw std::out_of_range There are no values
+     */
+    Qvalue min() const;
+
+    /**
+     * Returns the largest value.
+     * @return                  The largest value in this instance's unit
+     * @throw std::out_of_range There are no values
+     */
+    Qvalue max() const;
+};
+
+namespace expr {
+
+/// Arrays are held by reference in expressions.
+template<>
+struct Stored<QvalueArray>
+{
+    using type = const QvalueArray&;    ///< Type of the member that holds the operand
+};
+
+/// The elements of arrays are accessed directly by expressions.
+template<>
+struct Access<QvalueArray>
+{
+    /// Returns an element.
+    template<bool LINEAR>
+    static double get(const QvalueArray& array, const size_t i) noexcept
+    {
+        return array[i];
+    }
+
+    /// Indicates if every conversion is linear: arrays have no conversions.
+    static bool isLinear(const QvalueArray&) noexcept
+    {
+        return true;
+    }
+};
+
+} // namespace expr
+
+} // namespace quantity
@@ -0,0 +1,58 @@
+/**
+ * This file implements lazy, unit-aware arithmetic expressions over arrays of values.
+ *
+ *        File: QvalueExpr.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QvalueExpr.h"
+
+#include "LinearConverter.h"
+
+using namespace std;
+
+namespace quantity {
+
+namespace expr {
+
+Conversion::Conversion(const Unit::Pimpl& from,
+                       const Unit::Pimpl& to)
+    : offset(0)
+    , scale(1)
+    , intercept(0)
+    , converter(Converter::Pimpl())
+    , linear(true)
+{
+    if (from.get() == to.get())
+        return;
+
+    converter = Unit::getConverter(from, to);
+    const auto impl = LinearConverter::cast(converter);
+    if (impl) {
+        offset = impl->getOffset();
+        scale = impl->getScale();
+        intercept = impl->getIntercept();
+    }
+    else {
+        linear = false;
+    }
+}
+
+} // namespace expr
+
+} // namespace quantity
@@ -0,0 +1,629 @@
+/**
+ * This file declares lazy, unit-aware arithmetic expressions over arrays of values.
+ *
+ *        File: QvalueExpr.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Converter.h"
+#include "Qvalue.h"
+#include "Unit.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+namespace quantity {
+
+/**
+ * Base of the expressions of arrays of values with units (e.g., `x0 + v0*t`, where `x0` and `v0`
+ * are QvalueArray-s and `t` is a Qvalue). Building an expression computes its unit, vets its
+ * operands, and obtains any conversions that its operands need, but doesn't touch their values.
+ * Evaluating it -- by assigning it to a QvalueArray or by reducing it with sum() -- computes each
+ * element in a single pass over the operands without intermediate arrays.
+ *
+ * An expression refers to its array operands rather than copying them, so it mustn't outlive
+ * them: assign it to a QvalueArray rather than keeping it in an `auto` variable.
+ * @tparam E    The type of the expression (i.e., the derived class)
+ */
+template<typename E>
+class QvalueExpr
+{
+public:
+    /**
+     * Returns the derived expression.
+     * @return The derived expression
+     */
+    const E& self() const noexcept
+    {
+        return static_cast<const E&>(*this);
+    }
+};
+
+namespace expr {
+
+/**
+ * How an operand is held by an expression. Expressions are held by value because they're small;
+ * arrays specialize this to be held by reference.
+ * @tparam E    The type of the operand
+ */
+template<typename E>
+struct Stored
+{
+    using type = const E;   ///< Type of the member that holds the operand
+};
+
+/**
+ * How the elements of an operand are accessed by an expression. Arrays specialize this.
+ * @tparam E    The type of the operand
+ */
+template<typename E>
+struct Access
+{
+    /**
+     * Returns an element.
+     * @tparam    LINEAR    Whether every conversion in the operand is known to be linear
+     * @param[in] e         The operand
+     * @param[in] i         The index of the element
+     * @return              The element
+     */
+    template<bool LINEAR>
+    static double get(const E& e, const size_t i)
+    {
+        return e.template get<LINEAR>(i);
+    }
+
+    /**
+     * Indicates if every conversion in an operand is linear.
+     * @param[in] e     The operand
+     * @retval true     Every conversion is linear
+     * @retval false    Not every conversion is linear
+     */
+    static bool isLinear(const E& e) noexcept
+    {
+        return e.isLinear();
+    }
+};
+
+/**
+ * A scalar operand: a Qvalue or a plain number (which has no unit) broadcast to every element.
+ */
+class Scalar final : public QvalueExpr<Scalar>
+{
+    double      value;  ///< Numeric value
+    Unit::Pimpl unit;   ///< Unit of the value. Null for a plain number.
+
+public:
+    /// Whether the operand is a scalar
+    static constexpr bool scalar = true;
+
+    /**
+     * Constructs from a plain number.
+     * @param[in] value The number
+     */
+    explicit Scalar(const double value)
+        : value(value)
+        , unit()
+    {}
+
+    /**
+     * Constructs from a value with a unit.
+     * @param[in] value The value
+     */
+    explicit Scalar(const Qvalue& value)
+        : value(value.getValue())
+        , unit(value.getUnit())
+    {}
+
+    /**
+     * Returns the number of elements.
+     * @return Zero: a scalar conforms to any size
+     */
+    size_t size() const noexcept
+    {
+        return 0;
+    }
+
+    /**
+     * Returns the unit.
+     * @return The unit. Null for a plain number.
+     */
+    const Unit::Pimpl& getUnit() const noexcept
+    {
+        return unit;
+    }
+
+    /**
+     * Indicates if every conversion is linear.
+     * @retval true Always
+     */
+    bool isLinear() const noexcept
+    {
+        return true;
+    }
+
+    /**
+     * Returns an element.
+     * @return The value
+     */
+    template<bool LINEAR>
+    double get(const size_t) const noexcept
+    {
+        return value;
+    }
+
+    /**
+     * Returns an element.
+     * @return The value
+     */
+    double operator[](const size_t) const noexcept
+    {
+        return value;
+    }
+};
+
+/**
+ * A conversion of the values of an operand to the unit of another operand, resolved when an
+ * expression is built. Linear conversions (e.g., meters to millimeters) are inlined; others (e.g.,
+ * to logarithmic units) call the converter. An expression whose conversions are all linear is
+ * evaluated by a loop without calls, which can be vectorized.
+ */
+class Conversion final
+{
+    double    offset;       ///< Value subtracted from the input
+    double    scale;        ///< Multiplier of the offset input
+    double    intercept;    ///< Value added to the scaled input
+    Converter converter;    ///< The converter. Used if the conversion isn't linear.
+    bool      linear;       ///< Whether the conversion is linear
+
+public:
+    /**
+     * Constructs.
+     * @param[in] from              The unit of the values to be converted
+     * @param[in] to                The unit to convert them to
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    Conversion(const Unit::Pimpl& from,
+               const Unit::Pimpl& to);
+
+    /**
+     * Indicates if the conversion is linear.
+     * @retval true     The conversion is linear
+     * @retval false    The conversion isn't linear
+     */
+    bool isLinear() const noexcept
+    {
+        return linear;
+    }
+
+    /**
+     * Converts a value.
+     * @tparam    LINEAR    Whether the conversion is known to be linear
+     * @param[in] value     The value in the "from" unit
+     * @return              The value in the "to" unit
+     */
+    template<bool LINEAR>
+    double apply(const double value) const
+    {
+        return (LINEAR || linear)
+                ? scale*(value - offset) + intercept
+                : converter(value);
+    }
+};
+
+/**
+ * Base of binary expressions.
+ * @tparam D    The derived expression
+ * @tparam L    The type of the left operand
+ * @tparam R    The type of the right operand
+ */
+template<typename D, typename L, typename R>
+class Binary : public QvalueExpr<D>
+{
+protected:
+    typename Stored<L>::type lhs;   ///< Left operand
+    typename Stored<R>::type rhs;   ///< Right operand
+    Unit::Pimpl              unit;  ///< Unit of the result
+
+    /**
+     * Constructs.
+     * @param[in] lhs               The left operand
+     * @param[in] rhs               The right operand
+     * @param[in] unit              The unit of the result
+     * @throw std::invalid_argument The operands are arrays of different sizes
+     */
+    Binary(const L&           lhs,
+           const R&           rhs,
+           const Unit::Pimpl& unit)
+        : lhs(lhs)
+        , rhs(rhs)
+        , unit(unit)
+    {
+        if (!L::scalar && !R::scalar && lhs.size() != rhs.size())
+            throw std::invalid_argument("Arrays have different sizes: " +
+                    std::to_string(lhs.size()) + " and " + std::to_string(rhs.size()));
+    }
+
+public:
+    /// Whether the expression is a scalar
+    static constexpr bool scalar = L::scalar && R::scalar;
+
+    /**
+     * Returns the number of elements.
+     * @return The number of elements
+     */
+    size_t size() const noexcept
+    {
+        return L::scalar ? rhs.size() : lhs.size();
+    }
+
+    /**
+     * Returns the unit.
+     * @return The unit
+     */
+    const Unit::Pimpl& getUnit() const noexcept
+    {
+        return unit;
+    }
+
+    /**
+     * Indicates if every conversion in the operands is linear.
+     * @retval true     Every conversion is linear
+     * @retval false    Not every conversion is linear
+     */
+    bool isLinear() const noexcept
+    {
+        return Access<L>::isLinear(lhs) && Access<R>::isLinear(rhs);
+    }
+
+    /**
+     * Returns an element.
+     * @param[in] i The index of the element
+     * @return      The element
+     */
+    double operator[](const size_t i) const
+    {
+        return this->self().template get<false>(i);
+    }
+};
+
+/**
+ * The sum of two operands. The right operand is converted to the unit of the left.
+ * @tparam L    The type of the left operand
+ * @tparam R    The type of the right operand
+ */
+template<typename L, typename R>
+class Sum final : public Binary<Sum<L, R>, L, R>
+{
+    Conversion conversion;  ///< Conversion of the right operand
+
+public:
+    /**
+     * Constructs.
+     * @param[in] lhs               The left operand
+     * @param[in] rhs               The right operand
+     * @throw std::invalid_argument The operands are arrays of different sizes or their units
+     *                              aren't convertible
+     */
+    Sum(const L& lhs,
+        const R& rhs)
+        : Binary<Sum, L, R>(lhs, rhs, lhs.getUnit())
+        , conversion(rhs.getUnit(), lhs.getUnit())
+    {}
+
+    /**
+     * Indicates if every conversion in the expression is linear.
+     * @retval true     Every conversion is linear
+     * @retval false    Not every conversion is linear
+     */
+    bool isLinear() const noexcept
+    {
+        return conversion.isLinear() && Binary<Sum, L, R>::isLinear();
+    }
+
+    /**
+     * Returns an element.
+     * @tparam    LINEAR    Whether every conversion in the expression is known to be linear
+     * @param[in] i         The index of the element
+     * @return              The element
+     */
+    template<bool LINEAR>
+    double get(const size_t i) const
+    {
+        return Access<L>::template get<LINEAR>(this->lhs, i) +
+                conversion.template apply<LINEAR>(Access<R>::template get<LINEAR>(this->rhs, i));
+    }
+};
+
+/**
+ * The difference of two operands. The right operand is converted to the unit of the left.
+ * @tparam L    The type of the left operand
+ * @tparam R    The type of the right operand
+ */
+template<typename L, typename R>
+class Difference final : public Binary<Difference<L, R>, L, R>
+{
+    Conversion conversion;  ///< Conversion of the right operand
+
+public:
+    /**
+     * Constructs.
+     * @param[in] lhs               The left operand
+     * @param[in] rhs               The right operand
+     * @throw std::invalid_argument The operands are arrays of different sizes or their units
+     *                              aren't convertible
+     */
+    Difference(const L& lhs,
+               const R& rhs)
+        : Binary<Difference, L, R>(lhs, rhs, lhs.getUnit())
+        , conversion(rhs.getUnit(), lhs.getUnit())
+    {}
+
+    /**
+     * Indicates if every conversion in the expression is linear.
+     * @retval true     Every conversion is linear
+     * @retval false    Not every conversion is linear
+     */
+    bool isLinear() const noexcept
+    {
+        return conversion.isLinear() && Binary<Difference, L, R>::isLinear();
+    }
+
+    /**
+     * Returns an element.
+     * @tparam    LINEAR    Whether every conversion in the expression is known to be linear
+     * @param[in] i         The index of the element
+     * @return              The element
+     */
+    template<bool LINEAR>
+    double get(const size_t i) const
+    {
+        return Access<L>::template get<LINEAR>(this->lhs, i) -
+                conversion.template apply<LINEAR>(Access<R>::template get<LINEAR>(this->rhs, i));
+    }
+};
+
+/**
+ * The product of two operands. Its unit is the product of their units.
+ * @tparam L    The type of the left operand
+ * @tparam R    The type of the right operand
+ */
+template<typename L, typename R>
+class Product final : public Binary<Product<L, R>, L, R>
+{
+public:
+    /**
+     * Constructs.
+     * @param[in] lhs               The left operand
+     * @param[in] rhs               The right operand
+     * @throw std::invalid_argument The operands are arrays of different sizes
+     * @throw std::logic_error      The units can't be multiplied
+     */
+    Product(const L& lhs,
+            const R& rhs)
+        : Binary<Product, L, R>(lhs, rhs, !rhs.getUnit()
+                ? lhs.getUnit()
+                : !lhs.getUnit()
+                        ? rhs.getUnit()
+                        : lhs.getUnit()->multiply(rhs.getUnit()))
+    {}
+
+    /**
+     * Returns an element.
+     * @tparam    LINEAR    Whether every conversion in the expression is known to be linear
+     * @param[in] i         The index of the element
+     * @return              The element
+     */
+    template<bool LINEAR>
+    double get(const size_t i) const
+    {
+        return Access<L>::template get<LINEAR>(this->lhs, i)*
+                Access<R>::template get<LINEAR>(this->rhs, i);
+    }
+};
+
+/**
+ * The quotient of two operands. Its unit is the quotient of their units.
+ * @tparam L    The type of the left operand
+ * @tparam R    The type of the right operand
+ */
+template<typename L, typename R>
+class Quotient final : public Binary<Quotient<L, R>, L, R>
+{
+public:
+    /**
+     * Constructs.
+     * @param[in] lhs               The left operand
+     * @param[in] rhs               The right operand. Its unit mustn't be null unless the left's
+     *                              isn't.
+     * @throw std::invalid_argument The operands are arrays of different sizes
+     * @throw std::logic_error      The units can't be divided
+     */
+    Quotient(const L& lhs,
+             const R& rhs)
+        : Binary<Quotient, L, R>(lhs, rhs, !rhs.getUnit()
+                ? lhs.getUnit()
+                : lhs.getUnit()->divideBy(rhs.getUnit()))
+    {}
+
+    /**
+     * Returns an element.
+     * @tparam    LINEAR    Whether every conversion in the expression is known to be linear
+     * @param[in] i         The index of the element
+     * @return              The element
+     */
+    template<bool LINEAR>
+    double get(const size_t i) const
+    {
+        return Access<L>::template get<LINEAR>(this->lhs, i)/
+                Access<R>::template get<LINEAR>(this->rhs, i);
+    }
+};
+
+/**
+ * Evaluates an expression.
+ * @param[in]  e    The expression
+ * @param[out] out  The elements of the expression. Must have room for `e.size()` values.
+ */
+template<typename E>
+void evaluate(const E& e, double* out)
+{
+    const auto n = e.size();
+    if (Access<E>::isLinear(e)) {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = Access<E>::template get<true>(e, i);
+    }
+    else {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = Access<E>::template get<false>(e, i);
+    }
+}
+
+} // namespace expr
+
+/**
+ * Returns the sum of the elements of an expression without materializing it.
+ * @param[in] expr  The expression
+ * @return          The sum in the expression's unit
+ */
+template<typename E>
+Qvalue sum(const QvalueExpr<E>& expr)
+{
+    using Access = expr::Access<E>;
+    const auto& e = expr.self();
+    const auto  n = e.size();
+    double      sum = 0;
+    if (Access::isLinear(e)) {
+        for (size_t i = 0; i < n; ++i)
+            sum += Access::template get<true>(e, i);
+    }
+    else {
+        for (size_t i = 0; i < n; ++i)
+            sum += Access::template get<false>(e, i);
+    }
+    return Qvalue(sum, e.getUnit());
+}
+
+/// Adds two expressions.
+template<typename L, typename R>
+expr::Sum<L, R> operator+(const QvalueExpr<L>& lhs, const QvalueExpr<R>& rhs)
+{
+    return expr::Sum<L, R>(lhs.self(), rhs.self());
+}
+
+/// Adds a value to an expression.
+template<typename L>
+expr::Sum<L, expr::Scalar> operator+(const QvalueExpr<L>& lhs, const Qvalue& rhs)
+{
+    return expr::Sum<L, expr::Scalar>(lhs.self(), expr::Scalar(rhs));
+}
+
+/// Adds an expression to a value.
+template<typename R>
+expr::Sum<expr::Scalar, R> operator+(const Qvalue& lhs, const QvalueExpr<R>& rhs)
+{
+    return expr::Sum<expr::Scalar, R>(expr::Scalar(lhs), rhs.self());
+}
+
+/// Subtracts two expressions.
+template<typename L, typename R>
+expr::Difference<L, R> operator-(const QvalueExpr<L>& lhs, const QvalueExpr<R>& rhs)
+{
+    return expr::Difference<L, R>(lhs.self(), rhs.self());
+}
+
+/// Subtracts a value from an expression.
+template<typename L>
+expr::Difference<L, expr::Scalar> operator-(const QvalueExpr<L>& lhs, const Qvalue& rhs)
+{
+    return expr::Difference<L, expr::Scalar>(lhs.self(), expr::Scalar(rhs));
+}
+
+/// Subtracts an expression from a value.
+template<typename R>
+expr::Difference<expr::Scalar, R> operator-(const Qvalue& lhs, const QvalueExpr<R>& rhs)
+{
+    return expr::Difference<expr::Scalar, R>(expr::Scalar(lhs), rhs.self());
+}
+
+/// Multiplies two expressions.
+template<typename L, typename R>
+expr::Product<L, R> operator*(const QvalueExpr<L>& lhs, const QvalueExpr<R>& rhs)
+{
+    return expr::Product<L, R>(lhs.self(), rhs.self());
+}
+
+/// Multiplies an expression by a value.
+template<typename L>
+expr::Product<L, expr::Scalar> operator*(const QvalueExpr<L>& lhs, const Qvalue& rhs)
+{
+    return expr::Product<L, expr::Scalar>(lhs.self(), expr::Scalar(rhs));
+}
+
+/// Multiplies a value by an expression.
+template<typename R>
+expr::Product<expr::Scalar, R> operator*(const Qvalue& lhs, const QvalueExpr<R>& rhs)
+{
+    return expr::Product<expr::Scalar, R>(expr::Scalar(lhs), rhs.self());
+}
+
+/// Multiplies an expression by a number.
+template<typename L>
+expr::Product<L, expr::Scalar> operator*(const QvalueExpr<L>& lhs, const double rhs)
+{
+    return expr::Product<L, expr::Scalar>(lhs.self(), expr::Scalar(rhs));
+}
+
+/// Multiplies a number by an expression.
+template<typename R>
+expr::Product<expr::Scalar, R> operator*(const double lhs, const QvalueExpr<R>& rhs)
+{
+    return expr::Product<expr::Scalar, R>(expr::Scalar(lhs), rhs.self());
+}
+
+/// Divides two expressions.
+template<typename L, typename R>
+expr::Quotient<L, R> operator/(const QvalueExpr<L>& lhs, const QvalueExpr<R>& rhs)
+{
+    return expr::Quotient<L, R>(lhs.self(), rhs.self());
+}
+
+/// Divides an expression by a value.
+template<typename L>
+expr::Quotient<L, expr::Scalar> operator/(const QvalueExpr<L>& lhs, const Qvalue& rhs)
+{
+    return expr::Quotient<L, expr::Scalar>(lhs.self(), expr::Scalar(rhs));
+}
+
+/// Divides a value by an expression.
+template<typename R>
+expr::Quotient<expr::Scalar, R> operator/(const Qvalue& lhs, const QvalueExpr<R>& rhs)
+{
+    return expr::Quotient<expr::Scalar, R>(expr::Scalar(lhs), rhs.self());
+}
+
+/// Divides an expression by a number.
+template<typename L>
+expr::Quotient<L, expr::Scalar> operator/(const QvalueExpr<L>& lhs, const double rhs)
+{
+    return expr::Quotient<L, expr::Scalar>(lhs.self(), expr::Scalar(rhs));
+}
+
+} // namespace quantity
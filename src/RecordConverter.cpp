@@ -0,0 +1,103 @@
+/**
+ * This file implements a converter of the fields of an array of records.
+ *
+ *        File: RecordConverter.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecordConverter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+namespace quantity {
+
+/// Number of bytes of records that are converted at a time. Less than a level-1 data cache.
+static constexpr size_t BLOCK_BYTES = 16384;
+
+RecordConverter::RecordConverter(const size_t recordSize)
+    : recordSize(recordSize)
+    , blockSize(std::max<size_t>(1, BLOCK_BYTES/std::max<size_t>(1, recordSize)))
+    , fields()
+{
+    if (recordSize < sizeof(double))
+        throw invalid_argument("Record size " + std::to_string(recordSize) +
+                " is less than the size of a double");
+}
+
+RecordConverter& RecordConverter::add(const size_t     offset,
+                                      const Converter& converter)
+{
+    if (offset > recordSize - sizeof(double))
+        throw out_of_range("Field at offset " + std::to_string(offset) +
+                " doesn't fit within a record of " + std::to_string(recordSize) + " bytes");
+
+    for (auto& field : fields) {
+        if (field.offset == offset) {
+            field.converter = converter;
+            return *this;
+        }
+    }
+    for (const auto& field : fields) {
+        const auto distance = offset < field.offset ? field.offset - offset : offset - field.offset;
+        if (distance < sizeof(double))
+            throw invalid_argument("Field at offset " + std::to_string(offset) +
+                    " overlaps the field at offset " + std::to_string(field.offset));
+    }
+    fields.push_back(Field{offset, converter});
+    return *this;
+}
+
+size_t RecordConverter::getRecordSize() const noexcept
+{
+    return recordSize;
+}
+
+size_t RecordConverter::getNumFields() const noexcept
+{
+    return fields.size();
+}
+
+void RecordConverter::convert(const void*  in,
+                              void*        out,
+                              const size_t n) const
+{
+    for (size_t start = 0; start < n; start += blockSize) {
+        const auto  count = std::min(blockSize, n - start);
+        const char* block = static_cast<const char*>(in) + start*recordSize;
+        char*       outBlock = static_cast<char*>(out) + start*recordSize;
+
+        if (block != outBlock)
+            ::memcpy(outBlock, block, count*recordSize);
+        for (const auto& field : fields)
+            field.converter.convert(outBlock + field.offset, recordSize, outBlock + field.offset,
+                    recordSize, count);
+    }
+}
+
+void RecordConverter::convert(void*        records,
+                              const size_t n) const
+{
+    convert(records, records, n);
+}
+
+} // namespace quantity
@@ -0,0 +1,111 @@
+/**
+ * This file declares a converter of the fields of an array of records.
+ *
+ *        File: RecordConverter.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Converter.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace quantity {
+
+/**
+ * A converter of the fields of an array of records whose fields are interleaved (e.g., latitude,
+ * longitude, temperature, and pressure per record). A record is a fixed number of bytes (e.g., a
+ * structure, which may contain fields of any type and padding); each field to be converted is a
+ * double identified by its byte offset within the record and has its own converter. The fields
+ * needn't be aligned, so the records may be packed. Everything else in a record is copied
+ * unchanged.
+ *
+ * The records are converted a block at a time, where a block fits in the level-1 data cache, so
+ * every field is converted while the block is resident and the array is traversed once rather than
+ * once per field. The fields don't have to be de-interleaved into temporary arrays.
+ * @threadsafety Compatible
+ */
+class RecordConverter final
+{
+    /// A field to be converted
+    struct Field
+    {
+        size_t    offset;       ///< Byte offset of the field within a record
+        Converter converter;    ///< Converter of the field's values
+    };
+
+    size_t             recordSize;  ///< Number of bytes in a record
+    size_t             blockSize;   ///< Number of records converted at a time
+    std::vector<Field> fields;      ///< Fields to be converted
+
+public:
+    /**
+     * Constructs. The new instance converts no fields.
+     * @param[in] recordSize        Number of bytes in a record (e.g., `sizeof(Record)`)
+     * @throw std::invalid_argument The record size is less than the size of a double
+     */
+    explicit RecordConverter(const size_t recordSize);
+
+    /**
+     * Adds a double-precision field to be converted. A field that has already been added is
+     * replaced. Fields mustn't overlap.
+     * @param[in] offset            Byte offset of the field within a record (e.g.,
+     *                              `offsetof(Record, temp)`)
+     * @param[in] converter         Converter of the field's values
+     * @return                      A reference to this instance
+     * @throw std::out_of_range     The field doesn't fit within a record
+     * @throw std::invalid_argument The field overlaps a different field
+     */
+    RecordConverter& add(const size_t     offset,
+                         const Converter& converter);
+
+    /**
+     * Returns the number of bytes in a record.
+     * @return The number of bytes in a record
+     */
+    size_t getRecordSize() const noexcept;
+
+    /**
+     * Returns the number of fields to be converted.
+     * @return The number of fields to be converted
+     */
+    size_t getNumFields() const noexcept;
+
+    /**
+     * Converts an array of records. The input and output arrays may be the same array but must not
+     * otherwise overlap.
+     * @param[in]  in   The input records
+     * @param[out] out  The output records. Fields without a converter are copied from @ in.
+     * @param[in]  n    The number of records
+     */
+    void convert(const void*  in,
+                 void*        out,
+                 const size_t n) const;
+
+    /**
+     * Converts an array of records in place.
+     * @param[in,out] records   The records
+     * @param[in]     n         The number of records
+     */
+    void convert(void*        records,
+                 const size_t n) const;
+};
+
+} // namespace quantity
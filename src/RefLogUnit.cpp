@@ -25,7 +25,7 @@
 #include "AffineUnit.h"
 #include "CanonicalUnit.h"
 #include "Converter.h"
-#include "ConverterImpl.h"
+#include "ConverterIr.h"
 
 #include <cfloat>
 #include <cmath>
@@ -38,47 +38,6 @@ using namespace std;
 
 namespace quantity {
 
-/// Converter of numeric values in a referenced logarithmic unit to an output unit.
-class RefLogUnit::ToConverter : public ConverterImpl {
-private:
-    const Converter refConverter;   ///< The reference level's converter
-    const double    logBase;        ///< Natural logarithm of the logarithmic base
-
-public:
-    /**
-     * Move constructs.
-     * @param[in] refConverter  Reference level's converter to the output unit
-     * @param[in] logBase       Natural logarithm of the logarithmic base
-     */
-    ToConverter(const Converter&& refConverter, const double logBase)
-        : refConverter(refConverter)
-        , logBase(logBase)
-    {}
-    double operator()(const double value) const override {
-        return refConverter(exp(value*logBase));
-    }
-};
-
-/// Converter of numeric values in an input unit to a referenced logarithmic unit.
-class RefLogUnit::FromConverter : public ConverterImpl {
-private:
-    const Converter refConverter;   ///< The reference level's converter
-    const double    logBase;        ///< Natural logarithm of the logarithmic base
-public:
-    /**
-     * Move constructs.
-     * @param[in] refConverter  Reference level's converter from the input unit
-     * @param[in] logBase       Natural logarithm of the logarithmic base
-     */
-    FromConverter(const Converter&& refConverter, const double logBase)
-        : refConverter(refConverter)
-        , logBase(logBase)
-    {}
-    double operator()(const double value) const override {
-        return log(refConverter(value))/logBase;
-    }
-};
-
 RefLogUnit::RefLogUnit(const Pimpl&  ref,
                        const BaseEnum base)
     : LogUnit(base)
@@ -125,6 +84,8 @@ size_t RefLogUnit::hash() const
 
 int RefLogUnit::compare(const Pimpl& other) const
 {
+    if (other.get() == this)
+        return 0;
     return -other->compareTo(*this);
 }
 
@@ -140,7 +101,7 @@ int RefLogUnit::compareTo(const AffineUnit& other) const
 
 int RefLogUnit::compareTo(const RefLogUnit& other) const
 {
-    auto cmp = refLevel->compareTo(other);
+    auto cmp = refLevel->compare(other.refLevel);
     if (cmp == 0)
         cmp = (logBase < other.logBase)
             ? -1
@@ -155,35 +116,36 @@ int RefLogUnit::compareTo(const UnrefLogUnit& other) const
     return -1;  ///< Referenced log units come before unreferenced ones
 }
 
-bool RefLogUnit::isConvertible(const Pimpl& other) const
+bool RefLogUnit::isConvertible(const Pimpl& other) const noexcept
 {
+    if (other.get() == this)
+        return true;
     return refLevel->isConvertible(other);
 }
 
-bool RefLogUnit::isConvertibleTo(const CanonicalUnit& other) const
+bool RefLogUnit::isConvertibleTo(const CanonicalUnit& other) const noexcept
 {
     return refLevel->isConvertibleTo(other);
 }
 
-bool RefLogUnit::isConvertibleTo(const AffineUnit& other) const
+bool RefLogUnit::isConvertibleTo(const AffineUnit& other) const noexcept
 {
     return refLevel->isConvertibleTo(other);
 }
 
-bool RefLogUnit::isConvertibleTo(const RefLogUnit& other) const
+bool RefLogUnit::isConvertibleTo(const RefLogUnit& other) const noexcept
 {
     return refLevel->isConvertible(other.refLevel);
 }
 
-bool RefLogUnit::isConvertibleTo(const UnrefLogUnit& other) const
+bool RefLogUnit::isConvertibleTo(const UnrefLogUnit& other) const noexcept
 {
-    throw std::logic_error("Conversion between referenced and unreferenced log units is not "
-            "possible");
+    return false; // Referenced and unreferenced log units are never convertible
 }
 
 Converter RefLogUnit::getConverterTo(const Pimpl& output) const
 {
-    return Converter(new ToConverter(refLevel->getConverterTo(output), logBase));
+    return ConverterIr().exp(logBase).append(refLevel->getConverterTo(output)).compile();
 }
 
 Converter RefLogUnit::getConverterFrom(const CanonicalUnit& input) const
@@ -191,7 +153,7 @@ Converter RefLogUnit::getConverterFrom(const CanonicalUnit& input) const
     if (!input.isConvertibleTo(*this))
         throw invalid_argument("Units are not convertible");
 
-    return Converter(new FromConverter(input.getConverterTo(refLevel), logBase));
+    return ConverterIr().append(input.getConverterTo(refLevel)).log(1/logBase).compile();
 }
 
 Converter RefLogUnit::getConverterFrom(const AffineUnit& input) const
@@ -199,7 +161,7 @@ Converter RefLogUnit::getConverterFrom(const AffineUnit& input) const
     if (!input.isConvertibleTo(*this))
         throw invalid_argument("Units are not convertible");
 
-    return Converter(new FromConverter(input.getConverterTo(refLevel), logBase));
+    return ConverterIr().append(input.getConverterTo(refLevel)).log(1/logBase).compile();
 }
 
 Converter RefLogUnit::getConverterFrom(const RefLogUnit& input) const
@@ -207,7 +169,7 @@ Converter RefLogUnit::getConverterFrom(const RefLogUnit& input) const
     if (!input.isConvertibleTo(*this))
         throw invalid_argument("Units are not convertible");
 
-    return Converter(new FromConverter(input.getConverterTo(refLevel), logBase));
+    return ConverterIr().append(input.getConverterTo(refLevel)).log(1/logBase).compile();
 }
 
 Converter RefLogUnit::getConverterFrom(const UnrefLogUnit& input) const
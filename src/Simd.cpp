@@ -0,0 +1,705 @@
+/**
+ * This file implements vectorized kernels for converting arrays of numeric values.
+ *
+ *        File: Simd.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Simd.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#   define QUANTITY_X86 1
+#   include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace quantity {
+
+// Constants of the exponential and logarithm kernels. The natural logarithm of two is split into a
+// high part with trailing zero bits and a low part so that "k*LN2_HI" is exact (Cody & Waite).
+static const double LOG2_E    = 1.44269504088896338700e+00; ///< log2(e)
+static const double LN2_HI    = 6.93147180369123816490e-01; ///< High part of ln(2)
+static const double LN2_LO    = 1.90821492927058770002e-10; ///< Low part of ln(2)
+static const double ROUND     = 6755399441055744.0;         ///< 1.5*2^52: Rounds to an integer
+static const double EXP_BIAS  = 4503599627370496.0 + 1023;  ///< 2^52 + exponent bias
+static const double EXP_MIN   = -746;                       ///< exp() underflows to zero below
+static const double EXP_MAX   = 710;                        ///< exp() overflows to infinity above
+static const double SQRT2     = 1.41421356237309504880e+00; ///< sqrt(2)
+static const double TWO52     = 4503599627370496.0;         ///< 2^52
+static const double DBL_NORM  = 2.2250738585072014e-308;    ///< Smallest normal double
+
+/// Taylor coefficients 1/k! of exp(r), for k = 13 down to 0, for |r| <= ln(2)/2
+static const double EXP_COEFS[] = {
+        1.0/6227020800.0, 1.0/479001600.0, 1.0/39916800.0, 1.0/3628800.0, 1.0/362880.0,
+        1.0/40320.0, 1.0/5040.0, 1.0/720.0, 1.0/120.0, 1.0/24.0, 1.0/6.0, 0.5, 1.0, 1.0};
+
+/// Taylor coefficients 2/(2j+1) of (2*atanh(s) - 2*s)/s^3 as a series in s^2, for j = 11 down to 1
+static const double LOG_COEFS[] = {
+        2.0/23, 2.0/21, 2.0/19, 2.0/17, 2.0/15, 2.0/13, 2.0/11, 2.0/9, 2.0/7, 2.0/5, 2.0/3};
+
+/// Portable exponential kernel. The C math library is faster than a scalar polynomial.
+static void expScalar(const double* in,
+                      double*       out,
+                      const size_t  n,
+                      const double  scale)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = std::exp(scale*in[i]);
+}
+
+/// Portable logarithm kernel. The C math library is faster than a scalar polynomial.
+static void logScalar(const double* in,
+                      double*       out,
+                      const size_t  n,
+                      const double  scale)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = scale*std::log(in[i]);
+}
+
+/// Portable linear kernel.
+static void linearScalar(const double* in,
+                         double*       out,
+                         const size_t  n,
+                         const double  offset,
+                         const double  scale,
+                         const double  intercept)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = scale*(in[i] - offset) + intercept;
+}
+
+/// Portable single-precision linear kernel.
+static void linearSingleScalar(const float* in,
+                               float*       out,
+                               const size_t n,
+                               const float  offset,
+                               const float  scale,
+                               const float  intercept)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = scale*(in[i] - offset) + intercept;
+}
+
+/// Portable mixed-precision linear kernel.
+static void linearMixedScalar(const float*  in,
+                              float*        out,
+                              const size_t  n,
+                              const double  offset,
+                              const double  scale,
+                              const double  intercept)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = static_cast<float>(scale*(in[i] - offset) + intercept);
+}
+
+/// Portable widening linear kernel.
+static void linearWideningScalar(const float*  in,
+                                 double*       out,
+                                 const size_t  n,
+                                 const double  offset,
+                                 const double  scale,
+                                 const double  intercept)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = scale*(in[i] - offset) + intercept;
+}
+
+#ifdef QUANTITY_X86
+
+/// Portable linear kernel that uses fused multiply-add.
+__attribute__((target("fma")))
+static void linearFma(const double* in,
+                      double*       out,
+                      const size_t  n,
+                      const double  offset,
+                      const double  scale,
+                      const double  intercept)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = std::fma(scale, in[i] - offset, intercept);
+}
+
+/// Portable single-precision linear kernel that uses fused multiply-add.
+__attribute__((target("fma")))
+static void linearSingleFma(const float* in,
+                            float*       out,
+                            const size_t n,
+                            const float  offset,
+                            const float  scale,
+                            const float  intercept)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = std::fma(scale, in[i] - offset, intercept);
+}
+
+/// Portable mixed-precision linear kernel that uses fused multiply-add.
+__attribute__((target("fma")))
+static void linearMixedFma(const float*  in,
+                           float*        out,
+                           const size_t  n,
+                           const double  offset,
+                           const double  scale,
+                           const double  intercept)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = static_cast<float>(std::fma(scale, in[i] - offset, intercept));
+}
+
+/// Portable widening linear kernel that uses fused multiply-add.
+__attribute__((target("fma")))
+static void linearWideningFma(const float*  in,
+                              double*       out,
+                              const size_t  n,
+                              const double  offset,
+                              const double  scale,
+                              const double  intercept)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = std::fma(scale, in[i] - offset, intercept);
+}
+
+/// SSE2 linear kernel.
+__attribute__((target("sse2")))
+static void linearSse2(const double* in,
+                       double*       out,
+                       const size_t  n,
+                       const double  offset,
+                       const double  scale,
+                       const double  intercept)
+{
+    const __m128d off = _mm_set1_pd(offset);
+    const __m128d sc  = _mm_set1_pd(scale);
+    const __m128d ic  = _mm_set1_pd(intercept);
+    size_t        i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const __m128d v0 = _mm_loadu_pd(in + i);
+        const __m128d v1 = _mm_loadu_pd(in + i + 2);
+        _mm_storeu_pd(out + i,     _mm_add_pd(_mm_mul_pd(sc, _mm_sub_pd(v0, off)), ic));
+        _mm_storeu_pd(out + i + 2, _mm_add_pd(_mm_mul_pd(sc, _mm_sub_pd(v1, off)), ic));
+    }
+    linearScalar(in + i, out + i, n - i, offset, scale, intercept);
+}
+
+/// SSE2 linear kernel for hosts that also support fused multiply-add.
+__attribute__((target("sse2,fma")))
+static void linearSse2Fma(const double* in,
+                          double*       out,
+                          const size_t  n,
+                          const double  offset,
+                          const double  scale,
+                          const double  intercept)
+{
+    const __m128d off = _mm_set1_pd(offset);
+    const __m128d sc  = _mm_set1_pd(scale);
+    const __m128d ic  = _mm_set1_pd(intercept);
+    size_t        i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const __m128d v0 = _mm_loadu_pd(in + i);
+        const __m128d v1 = _mm_loadu_pd(in + i + 2);
+        _mm_storeu_pd(out + i,     _mm_fmadd_pd(sc, _mm_sub_pd(v0, off), ic));
+        _mm_storeu_pd(out + i + 2, _mm_fmadd_pd(sc, _mm_sub_pd(v1, off), ic));
+    }
+    linearFma(in + i, out + i, n - i, offset, scale, intercept);
+}
+
+/// AVX2 linear kernel. Uses fused multiply-add and a masked tail.
+__attribute__((target("avx2,fma")))
+static void linearAvx2(const double* in,
+                       double*       out,
+                       const size_t  n,
+                       const double  offset,
+                       const double  scale,
+                       const double  intercept)
+{
+    const __m256d off = _mm256_set1_pd(offset);
+    const __m256d sc  = _mm256_set1_pd(scale);
+    const __m256d ic  = _mm256_set1_pd(intercept);
+    size_t        i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256d v0 = _mm256_loadu_pd(in + i);
+        const __m256d v1 = _mm256_loadu_pd(in + i + 4);
+        _mm256_storeu_pd(out + i,     _mm256_fmadd_pd(sc, _mm256_sub_pd(v0, off), ic));
+        _mm256_storeu_pd(out + i + 4, _mm256_fmadd_pd(sc, _mm256_sub_pd(v1, off), ic));
+    }
+    for (; i < n; i += 4) {
+        const __m256i mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x(n - i),
+                _mm256_setr_epi64x(0, 1, 2, 3));
+        const __m256d v = _mm256_maskload_pd(in + i, mask);
+        _mm256_maskstore_pd(out + i, mask, _mm256_fmadd_pd(sc, _mm256_sub_pd(v, off), ic));
+    }
+}
+
+/// AVX-512 linear kernel. Uses fused multiply-add and a masked tail.
+__attribute__((target("avx512f")))
+static void linearAvx512(const double* in,
+                         double*       out,
+                         const size_t  n,
+                         const double  offset,
+                         const double  scale,
+                         const double  intercept)
+{
+    const __m512d off = _mm512_set1_pd(offset);
+    const __m512d sc  = _mm512_set1_pd(scale);
+    const __m512d ic  = _mm512_set1_pd(intercept);
+    size_t        i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m512d v0 = _mm512_loadu_pd(in + i);
+        const __m512d v1 = _mm512_loadu_pd(in + i + 8);
+        _mm512_storeu_pd(out + i,     _mm512_fmadd_pd(sc, _mm512_sub_pd(v0, off), ic));
+        _mm512_storeu_pd(out + i + 8, _mm512_fmadd_pd(sc, _mm512_sub_pd(v1, off), ic));
+    }
+    for (; i < n; i += 8) {
+        const __mmask8 mask = (n - i >= 8) ? 0xFF : static_cast<__mmask8>((1u << (n - i)) - 1);
+        const __m512d  v = _mm512_maskz_loadu_pd(mask, in + i);
+        _mm512_mask_storeu_pd(out + i, mask, _mm512_fmadd_pd(sc, _mm512_sub_pd(v, off), ic));
+    }
+}
+
+/// AVX2 single-precision linear kernel. Uses fused multiply-add.
+__attribute__((target("avx2,fma")))
+static void linearSingleAvx2(const float* in,
+                             float*       out,
+                             const size_t n,
+                             const float  offset,
+                             const float  scale,
+                             const float  intercept)
+{
+    const __m256 off = _mm256_set1_ps(offset);
+    const __m256 sc  = _mm256_set1_ps(scale);
+    const __m256 ic  = _mm256_set1_ps(intercept);
+    size_t       i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m256 v0 = _mm256_loadu_ps(in + i);
+        const __m256 v1 = _mm256_loadu_ps(in + i + 8);
+        _mm256_storeu_ps(out + i,     _mm256_fmadd_ps(sc, _mm256_sub_ps(v0, off), ic));
+        _mm256_storeu_ps(out + i + 8, _mm256_fmadd_ps(sc, _mm256_sub_ps(v1, off), ic));
+    }
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_fmadd_ps(sc, _mm256_sub_ps(_mm256_loadu_ps(in + i), off),
+                ic));
+    linearSingleFma(in + i, out + i, n - i, offset, scale, intercept);
+}
+
+/// AVX2 mixed-precision linear kernel. Widens four values at a time and uses fused multiply-add.
+__attribute__((target("avx2,fma")))
+static void linearMixedAvx2(const float*  in,
+                            float*        out,
+                            const size_t  n,
+                            const double  offset,
+                            const double  scale,
+                            const double  intercept)
+{
+    const __m256d off = _mm256_set1_pd(offset);
+    const __m256d sc  = _mm256_set1_pd(scale);
+    const __m256d ic  = _mm256_set1_pd(intercept);
+    size_t        i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256d v0 = _mm256_cvtps_pd(_mm_loadu_ps(in + i));
+        const __m256d v1 = _mm256_cvtps_pd(_mm_loadu_ps(in + i + 4));
+        const __m256d y0 = _mm256_fmadd_pd(sc, _mm256_sub_pd(v0, off), ic);
+        const __m256d y1 = _mm256_fmadd_pd(sc, _mm256_sub_pd(v1, off), ic);
+        _mm_storeu_ps(out + i,     _mm256_cvtpd_ps(y0));
+        _mm_storeu_ps(out + i + 4, _mm256_cvtpd_ps(y1));
+    }
+    linearMixedFma(in + i, out + i, n - i, offset, scale, intercept);
+}
+
+/// AVX2 widening linear kernel. Widens four values at a time and uses fused multiply-add.
+__attribute__((target("avx2,fma")))
+static void linearWideningAvx2(const float*  in,
+                               double*       out,
+                               const size_t  n,
+                               const double  offset,
+                               const double  scale,
+                               const double  intercept)
+{
+    const __m256d off = _mm256_set1_pd(offset);
+    const __m256d sc  = _mm256_set1_pd(scale);
+    const __m256d ic  = _mm256_set1_pd(intercept);
+    size_t        i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256d v0 = _mm256_cvtps_pd(_mm_loadu_ps(in + i));
+        const __m256d v1 = _mm256_cvtps_pd(_mm_loadu_ps(in + i + 4));
+        _mm256_storeu_pd(out + i,     _mm256_fmadd_pd(sc, _mm256_sub_pd(v0, off), ic));
+        _mm256_storeu_pd(out + i + 4, _mm256_fmadd_pd(sc, _mm256_sub_pd(v1, off), ic));
+    }
+    linearWideningFma(in + i, out + i, n - i, offset, scale, intercept);
+}
+
+/**
+ * Returns 2^k for integral values k in [-1022, 1023].
+ * @param[in] k     The integral values
+ * @return          2^k
+ */
+__attribute__((target("avx2,fma")))
+static inline __m256d pow2Avx2(const __m256d k)
+{
+    const __m256i biased = _mm256_castpd_si256(_mm256_add_pd(k, _mm256_set1_pd(EXP_BIAS)));
+    return _mm256_castsi256_pd(_mm256_slli_epi64(biased, 52));
+}
+
+/**
+ * AVX2 exponential kernel. The argument is reduced to "x = k*ln(2) + r" with |r| <= ln(2)/2, exp(r)
+ * is evaluated by its Taylor polynomial, and the result is scaled by 2^k in two steps so that
+ * subnormal results are correct.
+ */
+__attribute__((target("avx2,fma")))
+static void expAvx2(const double* in,
+                    double*       out,
+                    const size_t  n,
+                    const double  scale)
+{
+    const __m256d sc = _mm256_set1_pd(scale);
+    size_t        i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const __m256d arg = _mm256_mul_pd(sc, _mm256_loadu_pd(in + i));
+        const __m256d isNan = _mm256_cmp_pd(arg, arg, _CMP_UNORD_Q);
+        const __m256d x = _mm256_min_pd(_mm256_max_pd(arg, _mm256_set1_pd(EXP_MIN)),
+                _mm256_set1_pd(EXP_MAX));
+
+        const __m256d round = _mm256_set1_pd(ROUND);
+        const __m256d k = _mm256_sub_pd(_mm256_fmadd_pd(x, _mm256_set1_pd(LOG2_E), round), round);
+        __m256d       r = _mm256_fnmadd_pd(k, _mm256_set1_pd(LN2_HI), x);
+        r = _mm256_fnmadd_pd(k, _mm256_set1_pd(LN2_LO), r);
+
+        __m256d p = _mm256_set1_pd(EXP_COEFS[0]);
+        for (size_t j = 1; j < sizeof(EXP_COEFS)/sizeof(EXP_COEFS[0]); ++j)
+            p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(EXP_COEFS[j]));
+
+        const __m256d k1 = _mm256_floor_pd(_mm256_mul_pd(k, _mm256_set1_pd(0.5)));
+        const __m256d k2 = _mm256_sub_pd(k, k1);
+        const __m256d y = _mm256_mul_pd(_mm256_mul_pd(p, pow2Avx2(k1)), pow2Avx2(k2));
+
+        _mm256_storeu_pd(out + i, _mm256_blendv_pd(y, arg, isNan));
+    }
+    expScalar(in + i, out + i, n - i, scale);
+}
+
+/**
+ * AVX2 logarithm kernel. The argument is reduced to "x = 2^e*(1 + f)" with
+ * sqrt(1/2) <= 1 + f < sqrt(2) and log(1 + f) is evaluated as in fdlibm from s = f/(2 + f).
+ * Subnormal arguments are first scaled by 2^52.
+ */
+__attribute__((target("avx2,fma")))
+static void logAvx2(const double* in,
+                    double*       out,
+                    const size_t  n,
+                    const double  scale)
+{
+    const __m256d sc = _mm256_set1_pd(scale);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d inf = _mm256_set1_pd(numeric_limits<double>::infinity());
+    size_t        i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m256d       x = _mm256_loadu_pd(in + i);
+        const __m256d isSpecial = _mm256_or_pd(_mm256_cmp_pd(x, zero, _CMP_NGT_UQ),
+                _mm256_cmp_pd(x, inf, _CMP_EQ_OQ));
+        const __m256d special = _mm256_blendv_pd(
+                _mm256_blendv_pd(_mm256_set1_pd(numeric_limits<double>::quiet_NaN()),
+                        _mm256_set1_pd(-numeric_limits<double>::infinity()),
+                        _mm256_cmp_pd(x, zero, _CMP_EQ_OQ)),
+                inf, _mm256_cmp_pd(x, inf, _CMP_EQ_OQ));
+
+        const __m256d isSubnormal = _mm256_cmp_pd(x, _mm256_set1_pd(DBL_NORM), _CMP_LT_OQ);
+        x = _mm256_blendv_pd(x, _mm256_mul_pd(x, _mm256_set1_pd(TWO52)), isSubnormal);
+        __m256d e = _mm256_and_pd(isSubnormal, _mm256_set1_pd(-52));
+
+        // Exponent field to double: place the 11-bit field in the mantissa of 2^52 and subtract
+        const __m256i bits = _mm256_castpd_si256(x);
+        const __m256d two52 = _mm256_set1_pd(TWO52);
+        const __m256d expField = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+                _mm256_srli_epi64(bits, 52), _mm256_castpd_si256(two52))), two52);
+        e = _mm256_add_pd(e, _mm256_sub_pd(expField, _mm256_set1_pd(1023)));
+
+        __m256d m = _mm256_castsi256_pd(_mm256_or_si256(
+                _mm256_and_si256(bits, _mm256_set1_epi64x(0x000fffffffffffffLL)),
+                _mm256_set1_epi64x(0x3ff0000000000000LL)));
+        const __m256d isLarge = _mm256_cmp_pd(m, _mm256_set1_pd(SQRT2), _CMP_GT_OQ);
+        m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), isLarge);
+        e = _mm256_add_pd(e, _mm256_and_pd(isLarge, _mm256_set1_pd(1)));
+
+        const __m256d one = _mm256_set1_pd(1);
+        const __m256d f = _mm256_sub_pd(m, one);
+        const __m256d s = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2), f));
+        const __m256d z = _mm256_mul_pd(s, s);
+        __m256d       R = _mm256_set1_pd(LOG_COEFS[0]);
+        for (size_t j = 1; j < sizeof(LOG_COEFS)/sizeof(LOG_COEFS[0]); ++j)
+            R = _mm256_fmadd_pd(R, z, _mm256_set1_pd(LOG_COEFS[j]));
+        R = _mm256_mul_pd(R, z);
+        const __m256d hfsq = _mm256_mul_pd(_mm256_set1_pd(0.5), _mm256_mul_pd(f, f));
+        const __m256d logM = _mm256_sub_pd(f, _mm256_fnmadd_pd(s, _mm256_add_pd(hfsq, R), hfsq));
+
+        const __m256d y = _mm256_fmadd_pd(e, _mm256_set1_pd(LN2_HI),
+                _mm256_fmadd_pd(e, _mm256_set1_pd(LN2_LO), logM));
+
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(sc, _mm256_blendv_pd(y, special, isSpecial)));
+    }
+    logScalar(in + i, out + i, n - i, scale);
+}
+
+#endif // QUANTITY_X86
+
+bool Simd::isSupported(const Isa isa)
+{
+    switch (isa) {
+        case Isa::SCALAR: return true;
+#ifdef QUANTITY_X86
+        case Isa::SSE2:   return __builtin_cpu_supports("sse2");
+        case Isa::AVX2:   return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case Isa::AVX512: return __builtin_cpu_supports("avx512f");
+#endif
+        default:          return false;
+    }
+}
+
+Simd::Isa Simd::best()
+{
+    static const Isa isa = isSupported(Isa::AVX512)
+            ? Isa::AVX512
+            : isSupported(Isa::AVX2)
+              ? Isa::AVX2
+              : isSupported(Isa::SSE2)
+                ? Isa::SSE2
+                : Isa::SCALAR;
+    return isa;
+}
+
+bool Simd::isFused()
+{
+#ifdef QUANTITY_X86
+    static const bool fused = __builtin_cpu_supports("fma");
+    return fused;
+#else
+    return false;
+#endif
+}
+
+const char* Simd::to_string(const Isa isa)
+{
+    switch (isa) {
+        case Isa::SCALAR: return "SCALAR";
+        case Isa::SSE2:   return "SSE2";
+        case Isa::AVX2:   return "AVX2";
+        case Isa::AVX512: return "AVX512";
+        default:          return "UNKNOWN";
+    }
+}
+
+Simd::LinearKernel Simd::linearKernel(const Isa isa)
+{
+    if (!isSupported(isa))
+        throw invalid_argument(string("Instruction-set architecture ") + to_string(isa) +
+                " isn't supported");
+
+    switch (isa) {
+#ifdef QUANTITY_X86
+        case Isa::SSE2:   return isFused() ? linearSse2Fma : linearSse2;
+        case Isa::AVX2:   return linearAvx2;
+        case Isa::AVX512: return linearAvx512;
+        default:          return isFused() ? linearFma : linearScalar;
+#else
+        default:          return linearScalar;
+#endif
+    }
+}
+
+Simd::SingleLinearKernel Simd::linearSingleKernel(const Isa isa)
+{
+    if (!isSupported(isa))
+        throw invalid_argument(string("Instruction-set architecture ") + to_string(isa) +
+                " isn't supported");
+
+    switch (isa) {
+#ifdef QUANTITY_X86
+        case Isa::AVX2:
+        case Isa::AVX512: return linearSingleAvx2;
+        default:          return isFused() ? linearSingleFma : linearSingleScalar;
+#else
+        default:          return linearSingleScalar;
+#endif
+    }
+}
+
+Simd::MixedLinearKernel Simd::linearMixedKernel(const Isa isa)
+{
+    if (!isSupported(isa))
+        throw invalid_argument(string("Instruction-set architecture ") + to_string(isa) +
+                " isn't supported");
+
+    switch (isa) {
+#ifdef QUANTITY_X86
+        case Isa::AVX2:
+        case Isa::AVX512: return linearMixedAvx2;
+        default:          return isFused() ? linearMixedFma : linearMixedScalar;
+#else
+        default:          return linearMixedScalar;
+#endif
+    }
+}
+
+Simd::WideningLinearKernel Simd::linearWideningKernel(const Isa isa)
+{
+    if (!isSupported(isa))
+        throw invalid_argument(string("Instruction-set architecture ") + to_string(isa) +
+                " isn't supported");
+
+    switch (isa) {
+#ifdef QUANTITY_X86
+        case Isa::AVX2:
+        case Isa::AVX512: return linearWideningAvx2;
+        default:          return isFused() ? linearWideningFma : linearWideningScalar;
+#else
+        default:          return linearWideningScalar;
+#endif
+    }
+}
+
+Simd::TranscendentalKernel Simd::expKernel(const Isa isa)
+{
+    if (!isSupported(isa))
+        throw invalid_argument(string("Instruction-set architecture ") + to_string(isa) +
+                " isn't supported");
+
+    switch (isa) {
+#ifdef QUANTITY_X86
+        case Isa::AVX2:
+        case Isa::AVX512: return expAvx2;
+#endif
+        default:          return expScalar;
+    }
+}
+
+Simd::TranscendentalKernel Simd::logKernel(const Isa isa)
+{
+    if (!isSupported(isa))
+        throw invalid_argument(string("Instruction-set architecture ") + to_string(isa) +
+                " isn't supported");
+
+    switch (isa) {
+#ifdef QUANTITY_X86
+        case Isa::AVX2:
+        case Isa::AVX512: return logAvx2;
+#endif
+        default:          return logScalar;
+    }
+}
+
+void Simd::exp(const double* in,
+               double*       out,
+               const size_t  n,
+               const double  scale)
+{
+    static const TranscendentalKernel kernel = expKernel(best());
+    kernel(in, out, n, scale);
+}
+
+void Simd::log(const double* in,
+               double*       out,
+               const size_t  n,
+               const double  scale)
+{
+    static const TranscendentalKernel kernel = logKernel(best());
+    kernel(in, out, n, scale);
+}
+
+#ifdef QUANTITY_X86
+/// Computes "scale*(value - offset) + intercept" using fused multiply-add.
+__attribute__((target("fma")))
+static double linearFma(const double value,
+                        const double offset,
+                        const double scale,
+                        const double intercept)
+{
+    return std::fma(scale, value - offset, intercept);
+}
+#endif
+
+double Simd::linear(const double value,
+                    const double offset,
+                    const double scale,
+                    const double intercept)
+{
+#ifdef QUANTITY_X86
+    static const bool fused = isFused();
+    if (fused)
+        return linearFma(value, offset, scale, intercept);
+#endif
+    return scale*(value - offset) + intercept;
+}
+
+void Simd::linear(const double* in,
+                  double*       out,
+                  const size_t  n,
+                  const double  offset,
+                  const double  scale,
+                  const double  intercept)
+{
+    static const LinearKernel kernel = linearKernel(best());
+    kernel(in, out, n, offset, scale, intercept);
+}
+
+void Simd::linearSingle(const float* in,
+                        float*       out,
+                        const size_t n,
+                        const float  offset,
+                        const float  scale,
+                        const float  intercept)
+{
+    static const SingleLinearKernel kernel = linearSingleKernel(best());
+    kernel(in, out, n, offset, scale, intercept);
+}
+
+void Simd::linearMixed(const float* in,
+                       float*       out,
+                       const size_t n,
+                       const double offset,
+                       const double scale,
+                       const double intercept)
+{
+    static const MixedLinearKernel kernel = linearMixedKernel(best());
+    kernel(in, out, n, offset, scale, intercept);
+}
+
+void Simd::linearWidening(const float* in,
+                          double*      out,
+                          const size_t n,
+                          const double offset,
+                          const double scale,
+                          const double intercept)
+{
+    static const WideningLinearKernel kernel = linearWideningKernel(best());
+    kernel(in, out, n, offset, scale, intercept);
+}
+
+} // namespace quantity
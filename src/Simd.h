@@ -0,0 +1,298 @@
+/**
+ * This file declares vectorized kernels for converting arrays of numeric values. The kernel for the
+ * host's best instruction-set architecture is selected at runtime.
+ *
+ *        File: Simd.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace quantity {
+
+/// Vectorized conversion kernels with runtime selection of the instruction-set architecture.
+class Simd final
+{
+public:
+    /// Instruction-set architectures in order of increasing capability
+    enum class Isa {
+        SCALAR, ///< Portable C++
+        SSE2,   ///< x86 SSE2 (2 doubles per instruction)
+        AVX2,   ///< x86 AVX2 with FMA (4 doubles per instruction)
+        AVX512  ///< x86 AVX-512F (8 doubles per instruction)
+    };
+
+    /**
+     * Type of a kernel that computes "out[i] = scale*(in[i] - offset) + intercept". The input and
+     * output arrays may be the same array but must not otherwise overlap. If the host supports
+     * fused multiply-add, then every linear kernel uses it (see isFused()).
+     */
+    using LinearKernel = void (*)(const double* in,
+                                  double*       out,
+                                  size_t        n,
+                                  double        offset,
+                                  double        scale,
+                                  double        intercept);
+
+    /**
+     * Type of a kernel that computes "out[i] = scale*(in[i] - offset) + intercept" in single
+     * precision. The input and output arrays may be the same array but must not otherwise overlap.
+     */
+    using SingleLinearKernel = void (*)(const float* in,
+                                        float*       out,
+                                        size_t       n,
+                                        float        offset,
+                                        float        scale,
+                                        float        intercept);
+
+    /**
+     * Type of a kernel that computes "out[i] = scale*(in[i] - offset) + intercept" for
+     * single-precision values in double precision: each value is widened, converted, and rounded
+     * back to single precision. The input and output arrays may be the same array but must not
+     * otherwise overlap.
+     */
+    using MixedLinearKernel = void (*)(const float* in,
+                                       float*       out,
+                                       size_t       n,
+                                       double       offset,
+                                       double       scale,
+                                       double       intercept);
+
+    /**
+     * Type of a kernel that computes "out[i] = scale*(in[i] - offset) + intercept" in double
+     * precision from single-precision input values. The arrays must not overlap.
+     */
+    using WideningLinearKernel = void (*)(const float* in,
+                                          double*      out,
+                                          size_t       n,
+                                          double       offset,
+                                          double       scale,
+                                          double       intercept);
+
+    /**
+     * Type of a kernel that computes either "out[i] = exp(scale*in[i])" or
+     * "out[i] = scale*log(in[i])". The exponential and logarithm have an error of at most 2 ULP
+     * over their entire domain, including subnormal values; infinities and NaNs are handled as by
+     * the C math library. The input and output arrays may be the same array but must not otherwise
+     * overlap.
+     */
+    using TranscendentalKernel = void (*)(const double* in,
+                                          double*       out,
+                                          size_t        n,
+                                          double        scale);
+
+    /**
+     * Returns the most capable instruction-set architecture supported by the host.
+     * @return The most capable instruction-set architecture supported by the host
+     */
+    static Isa best();
+
+    /**
+     * Indicates if the host supports an instruction-set architecture.
+     * @param[in] isa   The instruction-set architecture
+     * @retval    true  The host supports the architecture
+     * @retval    false The host doesn't support the architecture
+     */
+    static bool isSupported(const Isa isa);
+
+    /**
+     * Indicates if the linear kernels use fused multiply-add, which they do if and only if the host
+     * supports it. Each value is then rounded once, so its result doesn't depend on the kernel that
+     * converts it, on its position in the array, or on how the array is divided between threads.
+     * @retval    true  The linear kernels use fused multiply-add
+     * @retval    false The linear kernels don't use fused multiply-add
+     */
+    static bool isFused();
+
+    /**
+     * Returns the name of an instruction-set architecture.
+     * @param[in] isa   The instruction-set architecture
+     * @return          The name of the architecture (e.g., "AVX2")
+     */
+    static const char* to_string(const Isa isa);
+
+    /**
+     * Returns the linear kernel for an instruction-set architecture.
+     * @param[in] isa               The instruction-set architecture
+     * @return                      The linear kernel for the architecture
+     * @throw std::invalid_argument The host doesn't support the architecture
+     */
+    static LinearKernel linearKernel(const Isa isa);
+
+    /**
+     * Returns the single-precision linear kernel for an instruction-set architecture. The AVX2
+     * kernel is returned for AVX-512 and the scalar kernel for SSE2.
+     * @param[in] isa               The instruction-set architecture
+     * @return                      The single-precision linear kernel for the architecture
+     * @throw std::invalid_argument The host doesn't support the architecture
+     */
+    static SingleLinearKernel linearSingleKernel(const Isa isa);
+
+    /**
+     * Returns the mixed-precision linear kernel for an instruction-set architecture. The AVX2
+     * kernel is returned for AVX-512 and the scalar kernel for SSE2.
+     * @param[in] isa               The instruction-set architecture
+     * @return                      The mixed-precision linear kernel for the architecture
+     * @throw std::invalid_argument The host doesn't support the architecture
+     */
+    static MixedLinearKernel linearMixedKernel(const Isa isa);
+
+    /**
+     * Returns the widening linear kernel for an instruction-set architecture. The AVX2 kernel is
+     * returned for AVX-512 and the scalar kernel for SSE2.
+     * @param[in] isa               The instruction-set architecture
+     * @return                      The widening linear kernel for the architecture
+     * @throw std::invalid_argument The host doesn't support the architecture
+     */
+    static WideningLinearKernel linearWideningKernel(const Isa isa);
+
+    /**
+     * Returns the exponential kernel for an instruction-set architecture. The AVX2 kernel is
+     * returned for AVX-512 and the scalar kernel, which uses the C math library, for SSE2.
+     * @param[in] isa               The instruction-set architecture
+     * @return                      The exponential kernel for the architecture
+     * @throw std::invalid_argument The host doesn't support the architecture
+     */
+    static TranscendentalKernel expKernel(const Isa isa);
+
+    /**
+     * Returns the logarithm kernel for an instruction-set architecture. The AVX2 kernel is returned
+     * for AVX-512 and the scalar kernel, which uses the C math library, for SSE2.
+     * @param[in] isa               The instruction-set architecture
+     * @return                      The logarithm kernel for the architecture
+     * @throw std::invalid_argument The host doesn't support the architecture
+     */
+    static TranscendentalKernel logKernel(const Isa isa);
+
+    /**
+     * Computes "out[i] = exp(scale*in[i])" using the host's best kernel.
+     * @param[in]  in           Input values
+     * @param[out] out          Output values. May be @ in.
+     * @param[in]  n            Number of values
+     * @param[in]  scale        Multiplier of each input value
+     * @see TranscendentalKernel
+     */
+    static void exp(const double* in,
+                    double*       out,
+                    const size_t  n,
+                    const double  scale);
+
+    /**
+     * Computes "out[i] = scale*log(in[i])" using the host's best kernel.
+     * @param[in]  in           Input values
+     * @param[out] out          Output values. May be @ in.
+     * @param[in]  n            Number of values
+     * @param[in]  scale        Multiplier of each logarithm
+     * @see TranscendentalKernel
+     */
+    static void log(const double* in,
+                    double*       out,
+                    const size_t  n,
+                    const double  scale);
+
+    /**
+     * Computes "scale*(value - offset) + intercept", rounded as by the linear kernels.
+     * @param[in] value         The value
+     * @param[in] offset        Value subtracted from the value
+     * @param[in] scale         Multiplier of the offset value
+     * @param[in] intercept     Value added to the scaled value
+     * @return                  The converted value
+     * @see isFused()
+     */
+    static double linear(const double value,
+                         const double offset,
+                         const double scale,
+                         const double intercept);
+
+    /**
+     * Computes "out[i] = scale*(in[i] - offset) + intercept" using the host's best kernel. The input
+     * and output arrays may be the same array but must not otherwise overlap.
+     * @param[in]  in           Input values
+     * @param[out] out          Output values
+     * @param[in]  n            Number of values
+     * @param[in]  offset       Value subtracted from each input value
+     * @param[in]  scale        Multiplier of each offset input value
+     * @param[in]  intercept    Value added to each scaled value
+     */
+    static void linear(const double* in,
+                       double*       out,
+                       const size_t  n,
+                       const double  offset,
+                       const double  scale,
+                       const double  intercept);
+
+    /**
+     * Computes "out[i] = scale*(in[i] - offset) + intercept" in single precision using the host's
+     * best kernel. The input and output arrays may be the same array but must not otherwise
+     * overlap.
+     * @param[in]  in           Input values
+     * @param[out] out          Output values
+     * @param[in]  n            Number of values
+     * @param[in]  offset       Value subtracted from each input value
+     * @param[in]  scale        Multiplier of each offset input value
+     * @param[in]  intercept    Value added to each scaled value
+     * @see SingleLinearKernel
+     */
+    static void linearSingle(const float* in,
+                             float*       out,
+                             const size_t n,
+                             const float  offset,
+                             const float  scale,
+                             const float  intercept);
+
+    /**
+     * Computes "out[i] = scale*(in[i] - offset) + intercept" for single-precision values in double
+     * precision using the host's best kernel. The input and output arrays may be the same array but
+     * must not otherwise overlap.
+     * @param[in]  in           Input values
+     * @param[out] out          Output values
+     * @param[in]  n            Number of values
+     * @param[in]  offset       Value subtracted from each input value
+     * @param[in]  scale        Multiplier of each offset input value
+     * @param[in]  intercept    Value added to each scaled value
+     * @see MixedLinearKernel
+     */
+    static void linearMixed(const float* in,
+                            float*       out,
+                            const size_t n,
+                            const double offset,
+                            const double scale,
+                            const double intercept);
+
+    /**
+     * Computes "out[i] = scale*(in[i] - offset) + intercept" in double precision from
+     * single-precision input values using the host's best kernel. The arrays must not overlap.
+     * @param[in]  in           Input values
+     * @param[out] out          Output values
+     * @param[in]  n            Number of values
+     * @param[in]  offset       Value subtracted from each input value
+     * @param[in]  scale        Multiplier of each offset input value
+     * @param[in]  intercept    Value added to each scaled value
+     * @see WideningLinearKernel
+     */
+    static void linearWidening(const float* in,
+                               double*      out,
+                               const size_t n,
+                               const double offset,
+                               const double scale,
+                               const double intercept);
+};
+
+} // namespace quantity
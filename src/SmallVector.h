@@ -0,0 +1,360 @@
+/**
+ * This file declares a vector that stores a small number of elements without allocating.
+ *
+ *        File: SmallVector.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace quantity {
+
+/**
+ * A contiguous, growable sequence of elements whose first `N` elements are stored inside the object
+ * itself. Only a sequence longer than `N` allocates. The subset of the std::vector API that's
+ * provided behaves the same.
+ * @tparam T    Type of the elements
+ * @tparam N    Number of elements stored inline
+ */
+template<typename T, size_t N>
+class SmallVector
+{
+    static_assert(N > 0, "SmallVector must have inline storage");
+
+private:
+    /// Uninitialized storage for one element
+    using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    Storage inlineElts[N];  ///< Inline storage
+    T*      elts;           ///< The elements: either the inline storage or heap storage
+    size_t  count;          ///< Number of elements
+    size_t  capacity;       ///< Number of elements that can be stored without reallocating
+
+    /**
+     * Returns the inline storage.
+     * @return The inline storage
+     */
+    T* inlineStorage() noexcept
+    {
+        return reinterpret_cast<T*>(inlineElts);
+    }
+
+    /**
+     * Indicates if the elements are in the inline storage.
+     * @retval true     The elements are in the inline storage
+     * @retval false    The elements are in heap storage
+     */
+    bool isInline() const noexcept
+    {
+        return elts == reinterpret_cast<const T*>(inlineElts);
+    }
+
+    /// Releases heap storage, if any, and reverts to the inline storage. The sequence must be empty.
+    void release() noexcept
+    {
+        if (!isInline())
+            ::operator delete(elts);
+        elts = inlineStorage();
+        capacity = N;
+    }
+
+    /**
+     * Moves the elements of another instance into this one, which must be empty and have only
+     * inline storage. The other instance is left empty.
+     * @param[in,out] other The other instance
+     */
+    void take(SmallVector& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (other.isInline()) {
+            for (size_t i = 0; i < other.count; ++i)
+                new(elts + i) T(std::move(other.elts[i]));
+            count = other.count;
+            other.clear();
+        }
+        else {
+            elts = other.elts;
+            count = other.count;
+            capacity = other.capacity;
+            other.elts = other.inlineStorage();
+            other.count = 0;
+            other.capacity = N;
+        }
+    }
+
+    /**
+     * Allocates heap storage.
+     * @param[in] n The number of elements the storage can hold
+     * @return      The storage
+     */
+    static T* allocate(const size_t n)
+    {
+        return static_cast<T*>(::operator new(n*sizeof(T)));
+    }
+
+    /**
+     * Moves the elements to new storage and releases the old storage, if it's on the heap.
+     * @param[in] newElts   The new storage
+     * @param[in] n         The number of elements the new storage can hold
+     */
+    void relocate(T*           newElts,
+                  const size_t n)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            new(newElts + i) T(std::move(elts[i]));
+            elts[i].~T();
+        }
+        if (!isInline())
+            ::operator delete(elts);
+        elts = newElts;
+        capacity = n;
+    }
+
+public:
+    using value_type = T;               ///< Type of the elements
+    using iterator = T*;                ///< Type of iterator
+    using const_iterator = const T*;    ///< Type of constant iterator
+
+    /// Default constructs an empty sequence.
+    SmallVector() noexcept
+        : elts(inlineStorage())
+        , count(0)
+        , capacity(N)
+    {}
+
+    /**
+     * Constructs from a list of elements.
+     * @param[in] init  The elements
+     */
+    SmallVector(std::initializer_list<T> init)
+        : SmallVector()
+    {
+        reserve(init.size());
+        for (const auto& elt : init)
+            push_back(elt);
+    }
+
+    /**
+     * Copy constructs.
+     * @param[in] other The other instance
+     */
+    SmallVector(const SmallVector& other)
+        : SmallVector()
+    {
+        reserve(other.count);
+        for (const auto& elt : other)
+            push_back(elt);
+    }
+
+    /**
+     * Move constructs.
+     * @param[in,out] other The other instance. Will be empty.
+     */
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : SmallVector()
+    {
+        take(other);
+    }
+
+    /// Destroys.
+    ~SmallVector() noexcept
+    {
+        clear();
+        release();
+    }
+
+    /**
+     * Copy assigns.
+     * @param[in] rhs   The other instance
+     * @return          A reference to this instance
+     */
+    SmallVector& operator=(const SmallVector& rhs)
+    {
+        if (this != &rhs) {
+            clear();
+            reserve(rhs.count);
+            for (const auto& elt : rhs)
+                push_back(elt);
+        }
+        return *this;
+    }
+
+    /**
+     * Move assigns.
+     * @param[in,out] rhs   The other instance. Will be empty.
+     * @return              A reference to this instance
+     */
+    SmallVector& operator=(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (this != &rhs) {
+            clear();
+            release();
+            take(rhs);
+        }
+        return *this;
+    }
+
+    /**
+     * Returns the number of elements.
+     * @return The number of elements
+     */
+    size_t size() const noexcept
+    {
+        return count;
+    }
+
+    /**
+     * Indicates if this instance has no elements.
+     * @retval true     This instance has no elements
+     * @retval false    This instance has elements
+     */
+    bool empty() const noexcept
+    {
+        return count == 0;
+    }
+
+    /**
+     * Ensures that a number of elements can be stored without reallocating.
+     * @param[in] n The number of elements
+     */
+    void reserve(const size_t n)
+    {
+        if (n <= capacity)
+            return;
+
+        relocate(allocate(n), n);
+    }
+
+    /**
+     * Appends an element constructed in place. The arguments may refer to an element of this
+     * instance (e.g., `v.push_back(v[0])`).
+     * @param[in] args  Arguments for the element's constructor
+     * @return          A reference to the new element
+     */
+    template<typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (count < capacity) {
+            new(elts + count) T(std::forward<Args>(args)...);
+        }
+        else {
+            // The new element is constructed before the old ones are moved because the arguments
+            // might refer to one of them
+            const auto newCapacity = 2*capacity;
+            auto       newElts = allocate(newCapacity);
+            try {
+                new(newElts + count) T(std::forward<Args>(args)...);
+            }
+            catch (...) {
+                ::operator delete(newElts);
+                throw;
+            }
+            relocate(newElts, newCapacity);
+        }
+        return elts[count++];
+    }
+
+    /**
+     * Appends an element.
+     * @param[in] elt   The element
+     */
+    void push_back(const T& elt)
+    {
+        emplace_back(elt);
+    }
+
+    /**
+     * Appends an element.
+     * @param[in] elt   The element
+     */
+    void push_back(T&& elt)
+    {
+        emplace_back(std::move(elt));
+    }
+
+    /// Removes all elements. Heap storage, if any, is retained.
+    void clear() noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+            elts[i].~T();
+        count = 0;
+    }
+
+    /**
+     * Returns a reference to an element.
+     * @param[in] i The index of the element
+     * @return      A reference to the element
+     */
+    T& operator[](const size_t i) noexcept
+    {
+        return elts[i];
+    }
+
+    /**
+     * Returns a reference to an element.
+     * @param[in] i The index of the element
+     * @return      A reference to the element
+     */
+    const T& operator[](const size_t i) const noexcept
+    {
+        return elts[i];
+    }
+
+    /**
+     * Returns an iterator to the first element.
+     * @return An iterator to the first element
+     */
+    iterator begin() noexcept
+    {
+        return elts;
+    }
+
+    /**
+     * Returns an iterator just past the last element.
+     * @return An iterator just past the last element
+     */
+    iterator end() noexcept
+    {
+        return elts + count;
+    }
+
+    /**
+     * Returns an iterator to the first element.
+     * @return An iterator to the first element
+     */
+    const_iterator begin() const noexcept
+    {
+        return elts;
+    }
+
+    /**
+     * Returns an iterator just past the last element.
+     * @return An iterator just past the last element
+     */
+    const_iterator end() const noexcept
+    {
+        return elts + count;
+    }
+};
+
+} // namespace quantity
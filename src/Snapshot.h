@@ -0,0 +1,298 @@
+/**
+ * This file declares a copy-on-write value whose readers don't lock.
+ *
+ *        File: Snapshot.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace quantity {
+
+/**
+ * A value that's read far more often than it's modified, such as a registry. Readers see an
+ * immutable snapshot of the value and take no lock. Writers are serialized: each one copies the
+ * current snapshot, modifies the copy, and publishes it. A replaced snapshot is deleted once no
+ * reader could still be using it.
+ *
+ * Readers are counted in stripes of counters so that readers on different threads seldom write the
+ * same cache line. Each reader also counts itself under the parity of an epoch. Replaced snapshots
+ * are reclaimed in batches: the epoch is incremented, which directs new readers to the other parity,
+ * and the batch is deleted once the readers counted under the old parity have finished. Reclamation
+ * is attempted by writers and by the last such readers, so it keeps up under sustained reading.
+ * @tparam T        Type of the value. Must be default and copy constructible.
+ * @threadsafety    Safe
+ */
+template<typename T>
+class Snapshot final
+{
+private:
+    /// Number of stripes of reader counters
+    static constexpr size_t NUM_STRIPES = 64;
+
+    /**
+     * Counters of readers in progress. The padding keeps the counters of adjacent stripes out of
+     * the same cache line whatever the alignment of the array.
+     */
+    struct Stripe final
+    {
+        std::atomic<size_t> readers[2];     ///< Number of readers in progress by epoch parity
+        char                padding[64];    ///< Separates these counters from the next stripe's
+    };
+
+    std::atomic<const T*>         current;       ///< The current snapshot
+    mutable Stripe                stripes[NUM_STRIPES]; ///< Counters of readers in progress
+    mutable std::atomic<size_t>   epoch;         ///< Incremented when a batch starts draining
+    std::mutex                    writeLock;     ///< Serializes writers
+    mutable std::mutex            reclaimLock;   ///< Protects `retired` and `draining`
+    mutable std::atomic<bool>     reclaimNeeded; ///< Whether reclamation should be attempted
+    mutable std::atomic<int>      drainParity;   ///< Parity whose readers `draining` awaits, or -1
+    mutable std::vector<const T*> retired;       ///< Replaced snapshots not yet draining
+    mutable std::vector<const T*> draining;      ///< Replaced snapshots awaiting older readers
+
+    /// Counts a reader for the duration of a read.
+    class ReadGuard final
+    {
+        const Snapshot&      snapshot;  ///< The snapshot being read
+        std::atomic<size_t>* readers;   ///< The counter of the reader
+        int                  parity;    ///< The parity of the epoch of the reader
+
+        /**
+         * Decrements the reader count and, if a batch of replaced snapshots awaits the readers of
+         * this reader's parity, attempts to reclaim it.
+         */
+        void release() noexcept
+        {
+            readers->fetch_sub(1);
+            if (snapshot.drainParity.load() == parity)
+                snapshot.tryReclaim();
+        }
+
+    public:
+        /**
+         * Constructs. Increments the reader count of the current epoch's parity. The epoch is
+         * checked afterwards so that a batch that starts draining concurrently sees the reader.
+         * @param[in] snapshot  The snapshot being read
+         */
+        explicit ReadGuard(const Snapshot& snapshot)
+            : snapshot(snapshot)
+            , readers(nullptr)
+            , parity(0)
+        {
+            auto& stripe = snapshot.stripes[stripeIndex()];
+            for (;;) {
+                const auto epoch = snapshot.epoch.load();
+                parity = static_cast<int>(epoch & 1);
+                readers = &stripe.readers[parity];
+                readers->fetch_add(1);
+                if (snapshot.epoch.load() == epoch)
+                    break;
+                release();
+            }
+        }
+
+        /// Destroys. Decrements the reader count.
+        ~ReadGuard() noexcept
+        {
+            release();
+        }
+    };
+
+    /**
+     * Returns the index of the stripe of reader counters of the current thread.
+     * @return The index of the stripe of the current thread
+     */
+    static size_t stripeIndex() noexcept
+    {
+        static std::atomic<size_t> next{0};
+        thread_local const size_t  index = next.fetch_add(1, std::memory_order_relaxed) %
+                NUM_STRIPES;
+        return index;
+    }
+
+    /**
+     * Indicates if no reader of an epoch parity is in progress.
+     * @param[in] parity  The parity
+     * @retval    true    No reader of the parity is in progress
+     * @retval    false   A reader of the parity might be in progress
+     */
+    bool isDrained(const int parity) const noexcept
+    {
+        for (const auto& stripe : stripes)
+            if (stripe.readers[parity].load() != 0)
+                return false;
+        return true;
+    }
+
+    /**
+     * Deletes replaced snapshots.
+     * @param[in,out] snapshots  The snapshots. Will be empty.
+     */
+    static void destroy(std::vector<const T*>& snapshots) noexcept
+    {
+        for (auto snapshot : snapshots)
+            delete snapshot;
+        snapshots.clear();
+    }
+
+    /**
+     * Deletes the draining batch if its readers have finished and, if it has, starts draining the
+     * replaced snapshots retired since. A reader that loaded a replaced snapshot was counted before
+     * the epoch was incremented, so a count of zero afterwards means that no such reader remains.
+     * @pre The reclamation lock is held
+     */
+    void reclaim() const noexcept
+    {
+        if (!draining.empty()) {
+            if (!isDrained(drainParity.load()))
+                return;
+            destroy(draining);
+            drainParity.store(-1);
+        }
+        if (!retired.empty()) {
+            draining.swap(retired);
+            const auto parity = static_cast<int>(epoch.fetch_add(1) & 1);
+            drainParity.store(parity); // Before the check so that the last reader sees it
+            if (isDrained(parity)) {
+                destroy(draining);
+                drainParity.store(-1);
+            }
+        }
+    }
+
+    /**
+     * Reclaims replaced snapshots if no other thread is doing so. If one is, then it will try again
+     * on this thread's behalf, so no opportunity to reclaim is lost.
+     */
+    void tryReclaim() const noexcept
+    {
+        do {
+            reclaimNeeded.store(true);
+            std::unique_lock<std::mutex> lock{reclaimLock, std::try_to_lock};
+            if (!lock)
+                return;
+            while (reclaimNeeded.exchange(false))
+                reclaim();
+        } while (reclaimNeeded.load());
+    }
+
+    /**
+     * Makes a modified copy the current value.
+     * @pre                 The write lock is held
+     * @param[in,out] copy  The modified copy. Will be empty.
+     */
+    void publish(std::unique_ptr<T>& copy)
+    {
+        {
+            std::lock_guard<std::mutex> guard{reclaimLock};
+            retired.push_back(nullptr); // Might throw, so before the copy is published
+            retired.back() = current.exchange(copy.release());
+        }
+        tryReclaim();
+    }
+
+    /**
+     * Modifies a copy of the current value with a function that returns nothing and publishes it.
+     * @pre                 The write lock is held
+     * @param[in]     func  The function
+     * @param[in,out] copy  The copy
+     */
+    template<typename Func>
+    void modify(Func& func, std::unique_ptr<T>& copy, std::true_type)
+    {
+        func(*copy);
+        publish(copy);
+    }
+
+    /**
+     * Modifies a copy of the current value with a function that returns a value and publishes it.
+     * @pre                 The write lock is held
+     * @param[in]     func  The function
+     * @param[in,out] copy  The copy
+     * @return              The function's return value
+     */
+    template<typename Func>
+    auto modify(Func& func, std::unique_ptr<T>& copy, std::false_type) -> decltype(func(*copy))
+    {
+        auto result = func(*copy);
+        publish(copy);
+        return result;
+    }
+
+public:
+    /// Default constructs. The initial value is default constructed.
+    Snapshot()
+        : current(new T())
+        , stripes()
+        , epoch(0)
+        , writeLock()
+        , reclaimLock()
+        , reclaimNeeded(false)
+        , drainParity(-1)
+        , retired()
+        , draining()
+    {}
+
+    Snapshot(const Snapshot& other) =delete;
+    Snapshot& operator=(const Snapshot& rhs) =delete;
+
+    /// Destroys. There must be no readers or writers.
+    ~Snapshot() noexcept
+    {
+        delete current.load();
+        destroy(retired);
+        destroy(draining);
+    }
+
+    /**
+     * Calls a function with the current value without locking.
+     * @param[in] func  Function to call with a constant reference to the current value. The
+     *                  reference must not be used after the function returns.
+     * @return          The function's return value
+     */
+    template<typename Func>
+    auto read(Func&& func) const -> decltype(func(std::declval<const T&>()))
+    {
+        ReadGuard guard{*this};
+        return func(*current.load());
+    }
+
+    /**
+     * Calls a function with a modifiable copy of the current value and then makes the copy the
+     * current value. If the function throws an exception, then the current value is unchanged.
+     * @param[in] func  Function to call with a reference to the copy of the current value
+     * @return          The function's return value
+     */
+    template<typename Func>
+    auto update(Func&& func) -> decltype(func(std::declval<T&>()))
+    {
+        std::lock_guard<std::mutex> guard{writeLock};
+        std::unique_ptr<T>          copy{new T(*current.load())};
+        return modify(func, copy, std::is_void<decltype(func(*copy))>{});
+    }
+};
+
+} // namespace quantity
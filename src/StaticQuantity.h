@@ -0,0 +1,451 @@
+/**
+ * This file declares physical quantities whose dimensionality and unit are known at compile time.
+ *
+ *        File: StaticQuantity.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Converter.h"
+#include "Exponent.h"
+#include "Unit.h"
+
+#include <array>
+#include <cstddef>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+namespace quantity {
+
+/**
+ * A dimensionality known at compile time: the integral exponents of an ordered list of base
+ * quantities (e.g., Dim<1, 0, -1> is length per time if the base quantities are length, mass, and
+ * time). Trailing zeros don't matter: Dim<1> and Dim<1, 0> are the same dimensionality.
+ * @tparam Exps Exponents of the base quantities in order
+ */
+template<int... Exps>
+struct Dim
+{
+    /// Number of base quantities
+    static constexpr size_t size = sizeof...(Exps);
+
+    /**
+     * Returns the exponent of a base quantity.
+     * @param[in] i Index of the base quantity
+     * @return      The exponent of the base quantity. Zero if @ i is out of range.
+     */
+    static constexpr int exp(const size_t i)
+    {
+        constexpr int exps[] = {Exps..., 0};
+        return i < size ? exps[i] : 0;
+    }
+};
+
+/**
+ * A scale factor known at compile time: the size of a unit relative to the product of the base
+ * units (e.g., Scale<1, 1000> for millimeters if the base unit of length is the meter).
+ */
+template<intmax_t Num, intmax_t Den = 1>
+using Scale = std::ratio<Num, Den>;
+
+namespace detail {
+
+/// Returns the larger of two sizes.
+constexpr size_t maxSize(const size_t a, const size_t b)
+{
+    return a < b ? b : a;
+}
+
+/// Product of two dimensionalities as a Dim
+template<typename D1, typename D2, typename Is>
+struct DimMultiply;
+
+template<typename D1, typename D2, size_t... Is>
+struct DimMultiply<D1, D2, std::index_sequence<Is...>>
+{
+    using type = Dim<(D1::exp(Is) + D2::exp(Is))...>;
+};
+
+/// Quotient of two dimensionalities as a Dim
+template<typename D1, typename D2, typename Is>
+struct DimDivide;
+
+template<typename D1, typename D2, size_t... Is>
+struct DimDivide<D1, D2, std::index_sequence<Is...>>
+{
+    using type = Dim<(D1::exp(Is) - D2::exp(Is))...>;
+};
+
+/// Integral power of a dimensionality as a Dim
+template<typename D, int N, typename Is>
+struct DimPow;
+
+template<typename D, int N, size_t... Is>
+struct DimPow<D, N, std::index_sequence<Is...>>
+{
+    using type = Dim<(D::exp(Is)*N)...>;
+};
+
+/**
+ * Indicates if two dimensionalities are equal.
+ * @param[in] i     Index of the first base quantity to compare
+ * @return          Whether the exponents of the base quantities from @ i on are equal
+ */
+template<typename D1, typename D2>
+constexpr bool dimEqual(const size_t i = 0)
+{
+    return i >= maxSize(D1::size, D2::size)
+            ? true
+            : D1::exp(i) == D2::exp(i) && dimEqual<D1, D2>(i + 1);
+}
+
+/// Integral power of a ratio
+template<typename R, int N, bool Negative = (N < 0)>
+struct RatioPow
+{
+    using type = std::ratio_multiply<R, typename RatioPow<R, N - 1>::type>;
+};
+
+template<typename R>
+struct RatioPow<R, 0, false>
+{
+    using type = std::ratio<1>;
+};
+
+template<typename R, int N>
+struct RatioPow<R, N, true>
+{
+    using type = std::ratio_divide<std::ratio<1>, typename RatioPow<R, -N>::type>;
+};
+
+/// Returns the greatest common divisor of two positive integers.
+constexpr intmax_t gcd(const intmax_t a, const intmax_t b)
+{
+    return b == 0 ? a : gcd(b, a % b);
+}
+
+/**
+ * Converts a floating-point numeric value by a ratio: it's multiplied by the ratio's value.
+ * @tparam    Ratio The ratio
+ * @param[in] value The numeric value
+ * @return          The converted numeric value
+ */
+template<typename Ratio, typename Rep>
+constexpr Rep rescale(const Rep value, std::true_type)
+{
+    return value*(static_cast<Rep>(Ratio::num)/static_cast<Rep>(Ratio::den));
+}
+
+/**
+ * Converts an integral numeric value by a ratio: it's multiplied by the ratio's numerator and then
+ * divided by its denominator, so a ratio less than one isn't truncated to zero. Like
+ * `std::chrono::duration_cast`, the result is truncated.
+ * @tparam    Ratio The ratio
+ * @param[in] value The numeric value
+ * @return          The converted numeric value
+ */
+template<typename Ratio, typename Rep>
+constexpr Rep rescale(const Rep value, std::false_type)
+{
+    using Common = typename std::common_type<Rep, intmax_t>::type;
+    return static_cast<Rep>(static_cast<Common>(value)*Ratio::num/Ratio::den);
+}
+
+/**
+ * Converts a numeric value by a ratio.
+ * @tparam    Ratio The ratio
+ * @param[in] value The numeric value
+ * @return          The converted numeric value
+ */
+template<typename Ratio, typename Rep>
+constexpr Rep rescale(const Rep value)
+{
+    return rescale<Ratio>(value, std::is_floating_point<Rep>{});
+}
+
+} // namespace detail
+
+/// The product of two dimensionalities
+template<typename D1, typename D2>
+using DimMultiply = typename detail::DimMultiply<D1, D2,
+        std::make_index_sequence<detail::maxSize(D1::size, D2::size)>>::type;
+
+/// The quotient of two dimensionalities
+template<typename D1, typename D2>
+using DimDivide = typename detail::DimDivide<D1, D2,
+        std::make_index_sequence<detail::maxSize(D1::size, D2::size)>>::type;
+
+/// An integral power of a dimensionality
+template<typename D, int N>
+using DimPow = typename detail::DimPow<D, N, std::make_index_sequence<D::size>>::type;
+
+/// Whether two dimensionalities are equal
+template<typename D1, typename D2>
+struct DimEqual : std::integral_constant<bool, detail::dimEqual<D1, D2>()> {};
+
+/**
+ * The common scale of two scales: the largest one of which both are integral multiples, like the
+ * period of `std::common_type` of two `std::chrono::duration`s (e.g., Scale<1, 1000> for meters and
+ * millimeters). Values in either scale convert to it exactly.
+ */
+template<typename S1, typename S2>
+using CommonScale = std::ratio<detail::gcd(S1::num, S2::num),
+        S1::den/detail::gcd(S1::den, S2::den)*S2::den>;
+
+/**
+ * A physical quantity whose dimensionality and unit are known at compile time. An instance holds
+ * only its numeric value, so arithmetic on it costs the same as arithmetic on `Rep`. Conversion
+ * factors between scales are computed at compile time, and operations on quantities of different
+ * dimensionalities don't compile.
+ *
+ * As with `std::chrono::duration`, a quantity converts implicitly to another scale only if no
+ * precision is lost: `Rep` is floating-point or the other scale divides this one. Otherwise,
+ * quantity_cast() must be used. Quantities in different scales are added, subtracted, and compared
+ * in their common scale (see CommonScale), so the results are exact and don't depend on the order
+ * of the operands.
+ *
+ * Interoperation with the runtime classes is via getUnit(), which returns the equivalent Unit, and
+ * fromUnit(), which converts a value in any convertible Unit.
+ * @tparam Rep  Type of the numeric value (e.g., `double`)
+ * @tparam D    Dimensionality (e.g., Dim<1, 0, -1>)
+ * @tparam S    Size of the unit relative to the product of the base units (e.g., Scale<1, 1000>)
+ */
+template<typename Rep, typename D, typename S = Scale<1>>
+class StaticQuantity
+{
+    Rep val;    ///< Numeric value in units of `S`
+
+public:
+    using rep = Rep;    ///< Type of the numeric value
+    using dim = D;      ///< Dimensionality
+    using scale = S;    ///< Scale of the unit
+
+    /**
+     * Constructs from a numeric value.
+     * @param[in] value The numeric value in units of this type
+     */
+    constexpr explicit StaticQuantity(const Rep value = Rep{0})
+        : val(value)
+    {}
+
+    /**
+     * Constructs from a quantity in a different scale of the same dimensionality. The conversion
+     * factor is computed at compile time. Only participates in overload resolution if the
+     * conversion is exact; use quantity_cast() otherwise.
+     * @tparam    D2    Dimensionality of the other quantity. Must equal `D`.
+     * @tparam    S2    Scale of the other quantity. Must be an integral multiple of `S` if `Rep`
+     *                  is integral.
+     * @param[in] other The other quantity
+     */
+    template<typename D2, typename S2, typename = std::enable_if_t<DimEqual<D, D2>::value &&
+            (std::is_floating_point<Rep>::value || std::ratio_divide<S2, S>::den == 1)>>
+    constexpr StaticQuantity(const StaticQuantity<Rep, D2, S2>& other)
+        : val(detail::rescale<std::ratio_divide<S2, S>>(other.value()))
+    {}
+
+    /**
+     * Returns the numeric value.
+     * @return The numeric value in units of this type
+     */
+    constexpr Rep value() const
+    {
+        return val;
+    }
+
+    /**
+     * Returns the runtime unit equivalent to this type's unit.
+     * @tparam    N     Number of base units. Must be positive.
+     * @param[in] bases The runtime base units in the order of the exponents of `D`
+     * @return          The equivalent runtime unit
+     */
+    template<size_t N>
+    static Unit::Pimpl getUnit(const std::array<Unit::Pimpl, N>& bases)
+    {
+        static_assert(N > 0, "No base units");
+        static_assert(N >= D::size, "Too few base units for dimensionality");
+        Unit::Pimpl unit = bases[0]->pow(Exponent(D::exp(0)));
+        for (size_t i = 1; i < N; ++i)
+            if (D::exp(i))
+                unit = unit->multiply(bases[i]->pow(Exponent(D::exp(i))));
+        return Unit::get(unit, static_cast<double>(S::den)/S::num, 0);
+    }
+
+    /**
+     * Returns the quantity corresponding to a numeric value in a runtime unit.
+     * @tparam    N             Number of base units
+     * @param[in] value         The numeric value
+     * @param[in] unit          The unit of the numeric value
+     * @param[in] bases         The runtime base units in the order of the exponents of `D`
+     * @return                  The corresponding quantity
+     * @throw std::invalid_argument The units aren't convertible
+     */
+    template<size_t N>
+    static StaticQuantity fromUnit(const double                      value,
+                                   const Unit::Pimpl&                unit,
+                                   const std::array<Unit::Pimpl, N>& bases)
+    {
+        return StaticQuantity(static_cast<Rep>(unit->getConverterTo(getUnit(bases))(value)));
+    }
+
+    /**
+     * Adds a quantity of the same dimensionality.
+     * @param[in] rhs   The other quantity
+     * @return          The sum in the common scale
+     */
+    template<typename D2, typename S2, typename = std::enable_if_t<DimEqual<D, D2>::value>>
+    constexpr StaticQuantity<Rep, D, CommonScale<S, S2>> operator+(
+            const StaticQuantity<Rep, D2, S2>& rhs) const
+    {
+        using Common = StaticQuantity<Rep, D, CommonScale<S, S2>>;
+        return Common(Common(*this).value() + Common(rhs).value());
+    }
+
+    /**
+     * Subtracts a quantity of the same dimensionality.
+     * @param[in] rhs   The other quantity
+     * @return          The difference in the common scale
+     */
+    template<typename D2, typename S2, typename = std::enable_if_t<DimEqual<D, D2>::value>>
+    constexpr StaticQuantity<Rep, D, CommonScale<S, S2>> operator-(
+            const StaticQuantity<Rep, D2, S2>& rhs) const
+    {
+        using Common = StaticQuantity<Rep, D, CommonScale<S, S2>>;
+        return Common(Common(*this).value() - Common(rhs).value());
+    }
+
+    /**
+     * Multiplies by a quantity.
+     * @param[in] rhs   The other quantity
+     * @return          The product. Its scale is the product of the scales.
+     */
+    template<typename D2, typename S2>
+    constexpr StaticQuantity<Rep, DimMultiply<D, D2>, std::ratio_multiply<S, S2>>
+    operator*(const StaticQuantity<Rep, D2, S2>& rhs) const
+    {
+        return StaticQuantity<Rep, DimMultiply<D, D2>, std::ratio_multiply<S, S2>>(
+                val*rhs.value());
+    }
+
+    /**
+     * Divides by a quantity.
+     * @param[in] rhs   The other quantity
+     * @return          The quotient. Its scale is the quotient of the scales.
+     */
+    template<typename D2, typename S2>
+    constexpr StaticQuantity<Rep, DimDivide<D, D2>, std::ratio_divide<S, S2>>
+    operator/(const StaticQuantity<Rep, D2, S2>& rhs) const
+    {
+        return StaticQuantity<Rep, DimDivide<D, D2>, std::ratio_divide<S, S2>>(val/rhs.value());
+    }
+
+    /**
+     * Multiplies by a number.
+     * @param[in] factor    The number
+     * @return              The product
+     */
+    constexpr StaticQuantity operator*(const Rep factor) const
+    {
+        return StaticQuantity(val*factor);
+    }
+
+    /**
+     * Divides by a number.
+     * @param[in] divisor   The number
+     * @return              The quotient
+     */
+    constexpr StaticQuantity operator/(const Rep divisor) const
+    {
+        return StaticQuantity(val/divisor);
+    }
+
+    /**
+     * Compares with a quantity of the same dimensionality in the common scale.
+     * @param[in] rhs   The other quantity
+     * @retval true     The quantities are equal
+     * @retval false    The quantities aren't equal
+     */
+    template<typename D2, typename S2, typename = std::enable_if_t<DimEqual<D, D2>::value>>
+    constexpr bool operator==(const StaticQuantity<Rep, D2, S2>& rhs) const
+    {
+        using Common = StaticQuantity<Rep, D, CommonScale<S, S2>>;
+        return Common(*this).value() == Common(rhs).value();
+    }
+
+    /**
+     * Compares with a quantity of the same dimensionality in the common scale.
+     * @param[in] rhs   The other quantity
+     * @retval true     This quantity is less than the other
+     * @retval false    This quantity isn't less than the other
+     */
+    template<typename D2, typename S2, typename = std::enable_if_t<DimEqual<D, D2>::value>>
+    constexpr bool operator<(const StaticQuantity<Rep, D2, S2>& rhs) const
+    {
+        using Common = StaticQuantity<Rep, D, CommonScale<S, S2>>;
+        return Common(*this).value() < Common(rhs).value();
+    }
+};
+
+/**
+ * Multiplies a number by a quantity.
+ * @param[in] factor    The number
+ * @param[in] q         The quantity
+ * @return              The product
+ */
+template<typename Rep, typename D, typename S>
+constexpr StaticQuantity<Rep, D, S> operator*(const Rep                         factor,
+                                              const StaticQuantity<Rep, D, S>& q)
+{
+    return q*factor;
+}
+
+/**
+ * Raises a quantity to an integral power.
+ * @tparam    N The power
+ * @param[in] q The quantity
+ * @return      The power of the quantity
+ */
+template<int N, typename Rep, typename D, typename S>
+constexpr StaticQuantity<Rep, DimPow<D, N>, typename detail::RatioPow<S, N>::type> pow(
+        const StaticQuantity<Rep, D, S>& q)
+{
+    using Result = StaticQuantity<Rep, DimPow<D, N>, typename detail::RatioPow<S, N>::type>;
+    Rep value{1};
+    for (int i = 0; i < (N < 0 ? -N : N); ++i)
+        value *= q.value();
+    return Result(N < 0 ? Rep{1}/value : value);
+}
+
+/**
+ * Converts a quantity to another type of the same dimensionality. The conversion factor is computed
+ * at compile time. Unlike an implicit conversion, the conversion may lose precision: like
+ * `std::chrono::duration_cast`, an integral value is truncated.
+ * @tparam    To    The type to convert to
+ * @param[in] q     The quantity
+ * @return          The converted quantity
+ */
+template<typename To, typename Rep, typename D, typename S>
+constexpr To quantity_cast(const StaticQuantity<Rep, D, S>& q)
+{
+    static_assert(DimEqual<typename To::dim, D>::value,
+            "Quantities have different dimensionalities");
+    return To(detail::rescale<std::ratio_divide<S, typename To::scale>>(q.value()));
+}
+
+} // namespace quantity
@@ -0,0 +1,256 @@
+/**
+ * This file implements a work-stealing pool of threads.
+ *
+ *        File: ThreadPool.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPool.h"
+
+#include <deque>
+#include <exception>
+
+using namespace std;
+
+namespace quantity {
+
+/// A parallel loop that's in progress.
+class ThreadPool::Job final
+{
+    const Body&             body;       ///< The body of the loop
+    atomic<size_t>          remaining;  ///< Number of tasks that haven't finished
+    mutex                   lock;       ///< Protects @ error and waiting for completion
+    condition_variable      cond;       ///< Signaled when the last task finishes
+    exception_ptr           error;      ///< The first exception thrown by a task
+
+public:
+    /**
+     * Constructs.
+     * @param[in] body      The body of the loop. Must exist until the job is done.
+     * @param[in] numTasks  Number of tasks
+     */
+    Job(const Body&  body,
+        const size_t numTasks)
+        : body(body)
+        , remaining(numTasks)
+        , lock()
+        , cond()
+        , error()
+    {}
+
+    /**
+     * Executes a task. An exception thrown by the body is saved if it's the first.
+     * @param[in] task  Index of the task
+     */
+    void execute(const size_t task) noexcept
+    {
+        try {
+            body(task);
+        }
+        catch (...) {
+            lock_guard<mutex> guard{lock};
+            if (!error)
+                error = current_exception();
+        }
+
+        // Under the lock so that the job can't be destroyed before this function is done with it
+        lock_guard<mutex> guard{lock};
+        if (remaining.fetch_sub(1, memory_order_acq_rel) == 1)
+            cond.notify_all();
+    }
+
+    /**
+     * Indicates if every task has finished.
+     * @retval true     Every task has finished
+     * @retval false    A task hasn't finished
+     */
+    bool isDone() const noexcept
+    {
+        return remaining.load(memory_order_acquire) == 0;
+    }
+
+    /// Waits until every task has finished. Must be called before the job is destroyed.
+    void wait()
+    {
+        unique_lock<mutex> guard{lock};
+        cond.wait(guard, [this]{return isDone();});
+    }
+
+    /**
+     * Rethrows the first exception thrown by a task, if any. Must only be called when the job is
+     * done.
+     * @throw The first exception thrown by a task
+     */
+    void rethrow()
+    {
+        if (error)
+            rethrow_exception(error);
+    }
+};
+
+/// A queue of tasks.
+class ThreadPool::Queue final
+{
+public:
+    /// A task of a parallel loop
+    struct Task
+    {
+        Job*   job;     ///< The loop
+        size_t index;   ///< Index of the task
+    };
+
+    mutex       lock;   ///< Protects @ tasks
+    deque<Task> tasks;  ///< The tasks
+};
+
+ThreadPool::ThreadPool(const size_t numThreads)
+    : threads()
+    , queues(new Queue[numThreads + 1]) // The last queue is for threads that aren't workers
+    , numQueues(numThreads + 1)
+    , lock()
+    , cond()
+    , pending(0)
+    , stop(false)
+{
+    threads.reserve(numThreads);
+    try {
+        for (size_t i = 0; i < numThreads; ++i)
+            threads.emplace_back(&ThreadPool::work, this, i);
+    }
+    catch (...) {
+        shutdown();
+        throw;
+    }
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+    shutdown();
+}
+
+void ThreadPool::shutdown() noexcept
+{
+    {
+        lock_guard<mutex> guard{lock};
+        stop = true;
+    }
+    cond.notify_all();
+    for (auto& thread : threads)
+        if (thread.joinable())
+            thread.join();
+}
+
+size_t ThreadPool::defaultNumThreads()
+{
+    const size_t numHardwareThreads = thread::hardware_concurrency();
+    return numHardwareThreads > 1 ? numHardwareThreads - 1 : 0;
+}
+
+ThreadPool& ThreadPool::getInstance()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+size_t ThreadPool::size() const noexcept
+{
+    return threads.size();
+}
+
+bool ThreadPool::runTask(const size_t first)
+{
+    if (pending.load(memory_order_acquire) == 0)
+        return false;
+
+    for (size_t i = 0; i < numQueues; ++i) {
+        auto&       queue = queues[(first + i) % numQueues];
+        Queue::Task task;
+        {
+            lock_guard<mutex> guard{queue.lock};
+            if (queue.tasks.empty())
+                continue;
+            if (i == 0) {
+                task = queue.tasks.front();
+                queue.tasks.pop_front();
+            }
+            else {
+                task = queue.tasks.back();
+                queue.tasks.pop_back();
+            }
+        }
+        pending.fetch_sub(1, memory_order_relaxed);
+        task.job->execute(task.index);
+        return true;
+    }
+
+    return false;
+}
+
+void ThreadPool::work(const size_t index)
+{
+    for (;;) {
+        if (runTask(index))
+            continue;
+
+        unique_lock<mutex> guard{lock};
+        cond.wait(guard, [this]{return stop || pending.load(memory_order_acquire) > 0;});
+        if (stop)
+            return;
+    }
+}
+
+void ThreadPool::parallelFor(const size_t numTasks,
+                             const Body&  body)
+{
+    if (numTasks == 0)
+        return;
+
+    Job job(body, numTasks);
+
+    if (threads.empty() || numTasks == 1) {
+        for (size_t task = 0; task < numTasks; ++task)
+            job.execute(task);
+    }
+    else {
+        {
+            // Before the tasks are queued so that it never underflows
+            lock_guard<mutex> guard{lock};
+            pending.fetch_add(numTasks, memory_order_release);
+        }
+
+        // Each queue receives a contiguous range of tasks
+        for (size_t i = 0; i < numQueues; ++i) {
+            const auto        begin = i*numTasks/numQueues;
+            const auto        end = (i + 1)*numTasks/numQueues;
+            auto&             queue = queues[i];
+            lock_guard<mutex> guard{queue.lock};
+            for (auto task = begin; task < end; ++task)
+                queue.tasks.push_back(Queue::Task{&job, task});
+        }
+        cond.notify_all();
+
+        // The calling thread helps until no tasks are queued and then waits for the rest
+        while (!job.isDone() && runTask(numQueues - 1))
+            ;
+    }
+
+    job.wait();
+    job.rethrow();
+}
+
+} // namespace quantity
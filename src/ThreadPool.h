@@ -0,0 +1,128 @@
+/**
+ * This file declares a work-stealing pool of threads.
+ *
+ *        File: ThreadPool.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace quantity {
+
+/**
+ * A pool of worker threads that execute the tasks of parallel loops. Each worker has its own queue
+ * of tasks. A loop's tasks are divided among the queues in contiguous ranges, so a worker executes
+ * neighbouring tasks (which, for an array that was first touched by the same division, reside on
+ * the worker's NUMA node). A worker takes tasks from the front of its queue in order; a worker
+ * whose queue is empty steals from the back of another worker's queue, which balances the load.
+ * The thread that starts a loop executes tasks too until the loop is done.
+ * @threadsafety Safe
+ */
+class ThreadPool final
+{
+public:
+    /// The body of a parallel loop: `void body(size_t task)`
+    using Body = std::function<void(size_t)>;
+
+private:
+    class Job;
+    class Queue;
+
+    std::vector<std::thread>    threads;    ///< Worker threads
+    std::unique_ptr<Queue[]>    queues;     ///< Task queue of each worker
+    size_t                      numQueues;  ///< Number of task queues
+    std::mutex                  lock;       ///< Protects @ stop and waiting for tasks
+    std::condition_variable     cond;       ///< Signaled when tasks are queued or on stop
+    std::atomic<size_t>         pending;    ///< Number of queued tasks
+    bool                        stop;       ///< Whether the workers should exit
+
+    /**
+     * Executes a queued task if one exists. The queue with the given index is tried first, from
+     * its front; the others are stolen from, from their back.
+     * @param[in] first     Index of the queue to try first
+     * @retval    true      A task was executed
+     * @retval    false     No task was queued
+     */
+    bool runTask(const size_t first);
+
+    /// Tells the worker threads to exit and waits for them to do so.
+    void shutdown() noexcept;
+
+    /**
+     * Executes tasks until the pool is destroyed.
+     * @param[in] index Index of the worker's queue
+     */
+    void work(const size_t index);
+
+public:
+    /**
+     * Constructs.
+     * @param[in] numThreads    Number of worker threads. The thread that starts a loop also
+     *                          executes its tasks, so zero is valid and makes loops serial.
+     */
+    explicit ThreadPool(const size_t numThreads = defaultNumThreads());
+
+    /// Destroys. Waits for the worker threads to exit.
+    ~ThreadPool() noexcept;
+
+    ThreadPool(const ThreadPool& other) =delete;
+    ThreadPool& operator=(const ThreadPool& rhs) =delete;
+
+    /**
+     * Returns the default number of worker threads: one less than the number of hardware threads,
+     * because the thread that starts a loop also executes its tasks.
+     * @return The default number of worker threads
+     */
+    static size_t defaultNumThreads();
+
+    /**
+     * Returns the process-wide pool, which is created on first use with the default number of
+     * worker threads.
+     * @return The process-wide pool
+     */
+    static ThreadPool& getInstance();
+
+    /**
+     * Returns the number of worker threads.
+     * @return The number of worker threads
+     */
+    size_t size() const noexcept;
+
+    /**
+     * Executes a parallel loop and returns when every task has been executed. May be called
+     * concurrently and from within a task.
+     * @param[in] numTasks  Number of tasks
+     * @param[in] body      The body of the loop. Called once for each task index in
+     *                      [0, @ numTasks), possibly concurrently.
+     * @throw               The first exception thrown by @ body. The remaining tasks are still
+     *                      executed.
+     */
+    void parallelFor(const size_t numTasks,
+                     const Body&  body);
+};
+
+} // namespace quantity
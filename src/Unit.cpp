@@ -20,24 +20,277 @@
 #include "Unit.h"
 
 #include "AffineUnit.h"
+#include "Arena.h"
 #include "BaseInfo.h"
 #include "CanonicalUnit.h"
+#include "ConverterCache.h"
 #include "Dimensionality.h"
 #include "RefLogUnit.h"
 #include "UnrefLogUnit.h"
 
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 using namespace std;
 
 namespace quantity {
 
+/**
+ * Process-wide table of interned units. The table is divided into shards by hash code, each with its
+ * own lock, so that threads creating different units seldom contend. A unit removes itself from its
+ * shard when it's destroyed.
+ */
+class UnitTable final
+{
+public:
+    /// A part of the table. Aligned to a cache line so that shards don't share one.
+    class alignas(64) Shard final
+    {
+        /// An interned unit
+        struct Entry final
+        {
+            const Unit*          unit; ///< The unit. Not deleted while the entry exists.
+            weak_ptr<const Unit> weak; ///< Reference to the unit
+        };
+
+        using Map = unordered_multimap<size_t, Entry>; ///< Type of shard's table
+
+        std::mutex lock;    ///< Protects this instance
+        Map        units;   ///< Interned units indexed by hash code
+
+        /**
+         * Returns the interned instance equal to a unit.
+         * @pre             The lock is held
+         * @param[in] hash  The unit's hash code
+         * @param[in] unit  The unit
+         * @return          The interned instance equal to @ unit or nullptr if none exists
+         */
+        Unit::Pimpl lookup(const size_t hash, const Unit::Pimpl& unit)
+        {
+            auto range = units.equal_range(hash);
+            for (auto iter = range.first; iter != range.second; ++iter) {
+                // An entry's unit can be dereferenced because it's deleted only after its entry is
+                // erased
+                if (iter->second.unit->compare(unit) == 0) {
+                    if (auto existing = iter->second.weak.lock())
+                        return existing;
+                }
+            }
+            return Unit::Pimpl{};
+        }
+
+    public:
+        /// Default constructs.
+        Shard()
+            : lock()
+            , units()
+        {}
+
+        /**
+         * Returns the interned instance equal to a unit.
+         * @param[in] hash  The unit's hash code
+         * @param[in] unit  The unit
+         * @return          The interned instance equal to @ unit or nullptr if none exists
+         */
+        Unit::Pimpl find(const size_t hash, const Unit::Pimpl& unit)
+        {
+            lock_guard<std::mutex> guard{lock};
+            return lookup(hash, unit);
+        }
+
+        /**
+         * Returns the interned instance of a unit.
+         * @param[in] hash  The unit's hash code
+         * @param[in] unit  The unit. Must have been created by Unit::intern().
+         * @return          The interned instance equal to @ unit. Will be @ unit if no such
+         *                  instance existed.
+         */
+        Unit::Pimpl intern(const size_t hash, const Unit::Pimpl& unit);
+
+        /**
+         * Removes a unit that's being destroyed.
+         * @param[in] hash  The unit's hash code
+         * @param[in] unit  The unit
+         */
+        void erase(const size_t hash, const Unit* unit) noexcept
+        {
+            lock_guard<std::mutex> guard{lock};
+
+            auto range = units.equal_range(hash);
+            for (auto iter = range.first; iter != range.second; ++iter) {
+                if (iter->second.unit == unit) {
+                    units.erase(iter);
+                    break;
+                }
+            }
+        }
+    };
+
+    /**
+     * Returns the shard for a hash code.
+     * @param[in] hash  The hash code
+     * @return          The shard for the hash code
+     */
+    static Shard& getShard(const size_t hash)
+    {
+        static constexpr unsigned SHARD_BITS = 6;   // Base-2 logarithm of the number of shards
+        static Shard              shards[1 << SHARD_BITS];
+
+        // The shard is chosen by the high bits of a Fibonacci hash so that it doesn't depend on the
+        // low bits by which a shard's map chooses a bucket
+        const auto index = (static_cast<uint64_t>(hash)*UINT64_C(0x9E3779B97F4A7C15)) >>
+                (64 - SHARD_BITS);
+        return shards[index];
+    }
+};
+
+/**
+ * Deletes a unit created by Unit::intern() and, if the unit was added to the process-wide table of
+ * interned units, removes it from the table first.
+ */
+struct UnitDeleter final
+{
+    UnitTable::Shard* shard;    ///< The shard containing the unit or nullptr
+    size_t            hash;     ///< The unit's hash code
+
+    /**
+     * Deletes a unit.
+     * @param[in] unit  The unit
+     */
+    void operator()(const Unit* const unit) const noexcept
+    {
+        if (shard)
+            shard->erase(hash, unit);
+        delete unit;
+    }
+};
+
+Unit::Pimpl UnitTable::Shard::intern(const size_t hash, const Unit::Pimpl& unit)
+{
+    lock_guard<std::mutex> guard{lock};
+
+    if (auto existing = lookup(hash, unit))
+        return existing;
+
+    units.emplace(hash, Entry{unit.get(), unit});
+    auto deleter = get_deleter<UnitDeleter>(unit);
+    deleter->shard = this;
+    deleter->hash = hash;
+    return unit;
+}
+
+/**
+ * Table of the units created in an arena scope. Units that are still referenced when the scope ends
+ * are moved to the table of the enclosing scope or, if there's none, to the process-wide table.
+ * Used by only one thread.
+ */
+class ScopeUnitTable final : public Arena::Local
+{
+    using Map = unordered_multimap<size_t, weak_ptr<const Unit>, hash<size_t>, equal_to<size_t>,
+            ArenaAllocator<pair<const size_t, weak_ptr<const Unit>>>>; ///< Type of table
+
+    Map units;  ///< Units indexed by hash code
+
+public:
+    /// Default constructs.
+    ScopeUnitTable()
+        : units()
+    {}
+
+    /// Destroys. Moves the units that are still referenced to the enclosing table.
+    ~ScopeUnitTable() noexcept
+    {
+        const auto scope = Arena::Scope::current(); // The enclosing scope
+        for (const auto& entry : units) {
+            if (auto unit = entry.second.lock()) {
+                try {
+                    if (scope) {
+                        scope->get<ScopeUnitTable>().add(entry.first, unit);
+                    }
+                    else {
+                        // If an equal unit was interned meanwhile, then this one remains a distinct
+                        // but equal instance
+                        UnitTable::getShard(entry.first).intern(entry.first, unit);
+                    }
+                }
+                catch (...) {
+                    // The unit remains valid but isn't interned
+                }
+            }
+        }
+    }
+
+    /**
+     * Returns the instance in this table that's equal to a unit.
+     * @param[in] hash  The unit's hash code
+     * @param[in] unit  The unit
+     * @return          The instance equal to @ unit or nullptr if none exists
+     */
+    Unit::Pimpl find(const size_t hash, const Unit::Pimpl& unit)
+    {
+        auto range = units.equal_range(hash);
+        for (auto iter = range.first; iter != range.second; ) {
+            auto existing = iter->second.lock();
+            if (!existing) {
+                iter = units.erase(iter);
+            }
+            else if (existing->compare(unit) == 0) {
+                return existing;
+            }
+            else {
+                ++iter;
+            }
+        }
+        return Unit::Pimpl{};
+    }
+
+    /**
+     * Adds a unit.
+     * @param[in] hash  The unit's hash code
+     * @param[in] unit  The unit
+     * @throw std::bad_alloc    Out of memory
+     */
+    void add(const size_t hash, const Unit::Pimpl& unit)
+    {
+        units.emplace(hash, unit);
+    }
+};
+
+Unit::Pimpl Unit::intern(const Unit* unit)
+{
+    // The control block comes from the thread's arena scope, if any
+    const Pimpl pimpl{unit, UnitDeleter{nullptr, 0}, ArenaAllocator<Unit>()};
+    const auto  hash = pimpl->hash();
+    auto&       shard = UnitTable::getShard(hash);
+    auto        scope = Arena::Scope::current();
+
+    if (scope == nullptr)
+        return shard.intern(hash, pimpl);
+
+    // A unit created in a scope is interned in the scope unless an equal unit exists, so the
+    // intermediate units of an expression don't enter the process-wide table
+    if (auto existing = shard.find(hash, pimpl))
+        return existing;
+    for (auto enclosing = scope; enclosing; enclosing = enclosing->enclosing()) {
+        if (auto table = enclosing->find<ScopeUnitTable>()) {
+            if (auto existing = table->find(hash, pimpl))
+                return existing;
+        }
+    }
+    scope->get<ScopeUnitTable>().add(hash, pimpl);
+    return pimpl;
+}
+
 Unit::Pimpl Unit::get(const BaseInfo& baseInfo)
 {
     Exponent exponent{1, 1};
-    return Unit::Pimpl(new CanonicalUnit(baseInfo, exponent));
+    return intern(new CanonicalUnit(baseInfo, exponent));
 }
 
 Unit::Pimpl Unit::get(const Pimpl& core,
@@ -46,23 +299,61 @@ Unit::Pimpl Unit::get(const Pimpl& core,
 {
     return (slope == 1 && intercept == 0)
         ? core
-        : Pimpl(new AffineUnit(core, slope, intercept));
+        : intern(new AffineUnit(core, slope, intercept));
 }
 
 Unit::Pimpl Unit::get(const Unit::BaseEnum base,
                       const Pimpl&        refLevel)
 {
-    return Pimpl(new RefLogUnit(refLevel, base));
+    return intern(new RefLogUnit(refLevel, base));
 }
 
 Unit::Pimpl Unit::get(const Unit::BaseEnum  base,
                       const Dimensionality& dim)
 {
-    return Pimpl(new UnrefLogUnit(base, dim));
+    return intern(new UnrefLogUnit(base, dim));
 }
 
 Unit::~Unit() noexcept =default;
 
+Converter Unit::getConverter(const Pimpl& input,
+                             const Pimpl& output)
+{
+    return ConverterCache::getInstance().get(input, output);
+}
+
+BidirectionalConverter Unit::getBidirectionalConverter(const Pimpl& input,
+                                                       const Pimpl& output)
+{
+    return ConverterCache::getInstance().getBidirectional(input, output);
+}
+
+Unit::ConverterResult Unit::tryGetConverter(const Pimpl& input,
+                                            const Pimpl& output) noexcept
+{
+    ConverterResult result{Converter(Converter::Pimpl()), ConverterError::NONE};
+
+    if (!input || !output) {
+        result.error = ConverterError::NULL_UNIT;
+    }
+    else if (!input->isConvertible(output)) {
+        result.error = ConverterError::INCONVERTIBLE;
+    }
+    else {
+        try {
+            result.converter = getConverter(input, output);
+        }
+        catch (const invalid_argument& ex) {
+            result.error = ConverterError::INCONVERTIBLE;
+        }
+        catch (...) {
+            result.error = ConverterError::FAILURE;
+        }
+    }
+
+    return result;
+}
+
 Unit::Pimpl Unit::divideBy(const Pimpl& unit) const
 {
     return multiply(unit->pow(Exponent(-1)));
@@ -66,6 +66,49 @@ public:
     /// Smart pointer to an implementation of a unit.
     using Pimpl = shared_ptr<const Unit>;
 
+    /// Reasons that a converter couldn't be obtained
+    enum class ConverterError
+    {
+        NONE,           ///< No error: the converter was obtained
+        NULL_UNIT,      ///< A unit is null
+        INCONVERTIBLE,  ///< Values aren't convertible between the units
+        FAILURE         ///< Some other failure (e.g., memory exhaustion)
+    };
+
+    /// Result of tryGetConverter()
+    struct ConverterResult
+    {
+        Converter      converter;   ///< The converter. Has no implementation unless @ error is
+                                    ///< ConverterError::NONE.
+        ConverterError error;       ///< Reason the converter wasn't obtained
+
+        /**
+         * Indicates if the converter was obtained.
+         * @retval true     The converter was obtained
+         * @retval false    The converter wasn't obtained
+         */
+        explicit operator bool() const noexcept
+        {
+            return error == ConverterError::NONE;
+        }
+    };
+
+protected:
+    /**
+     * Returns the interned instance of a unit. Structurally equal units (i.e., ones for which
+     * compare() returns zero) share a single instance, so they may be compared by pointer. The
+     * table of interned units only weakly references them. While an Arena::Scope exists on the
+     * current thread, a new unit is interned in a table of the scope and its shared pointer's control
+     * block is allocated from the scope; a unit that's still referenced when the scope ends is moved
+     * to the process-wide table. If an equal unit was created meanwhile on another thread, then the
+     * two remain distinct but equal instances.
+     * @param[in] unit  Pointer to a newly-allocated unit. Deleted if an equal unit already exists.
+     * @return          The interned instance equal to @ unit
+     * @threadsafety    Safe
+     */
+    static Pimpl intern(const Unit* unit);
+
+public:
     /// Destroys.
     virtual ~Unit() noexcept =0;
 
@@ -147,7 +190,8 @@ public:
     virtual size_t hash() const =0;
 
 	/**
-	 * Compares this instance to another.
+	 * Compares this instance to another. Because units are interned (see intern()), equal units are
+	 * almost always the same object, so implementations return zero at once in that case.
 	 * @param[in] other The other instance
 	 * @return          A value less than, equal to, or greater than zero as this instance is
 	 *                  considered less than, equal to, or greater than the other, respectively.
@@ -192,7 +236,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    virtual bool isConvertible(const Pimpl& other) const =0;
+    virtual bool isConvertible(const Pimpl& other) const noexcept =0;
 
     /**
      * Indicates if numeric values in this unit are convertible with a derived unit.
@@ -200,7 +244,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    virtual bool isConvertibleTo(const CanonicalUnit& other) const =0;
+    virtual bool isConvertibleTo(const CanonicalUnit& other) const noexcept =0;
 
     /**
      * Indicates if numeric values in this unit are convertible with an affine unit.
@@ -208,7 +252,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    virtual bool isConvertibleTo(const AffineUnit& other) const =0;
+    virtual bool isConvertibleTo(const AffineUnit& other) const noexcept =0;
 
     /**
      * Indicates if numeric values in this unit are convertible with a reference logarithmic unit.
@@ -216,7 +260,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    virtual bool isConvertibleTo(const RefLogUnit& other) const =0;
+    virtual bool isConvertibleTo(const RefLogUnit& other) const noexcept =0;
 
     /**
      * Indicates if numeric values in this unit are convertible with an unreferenced logarithmic
@@ -225,7 +269,48 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    virtual bool isConvertibleTo(const UnrefLogUnit& other) const =0;
+    virtual bool isConvertibleTo(const UnrefLogUnit& other) const noexcept =0;
+
+    /**
+     * Returns a converter of numeric values in one unit to another from the process-wide converter
+     * cache. The converter is created on the first request for the two units and shared by all
+     * subsequent requests for equal units.
+     * @param[in] input                     Input unit
+     * @param[in] output                    Output unit
+     * @return                              Converter from @ input to @ output
+     * @throw     std::invalid_argument     Values aren't convertible between the two units
+     * @threadsafety                        Safe
+     * @see ConverterCache
+     */
+    static Converter getConverter(const Pimpl& input,
+                                  const Pimpl& output);
+
+    /**
+     * Returns the converters of numeric values between two units in both directions via the
+     * process-wide converter cache. Unless the backward converter is cached, it's derived from the
+     * forward one by Converter::inverse() rather than by a second conversion dispatch.
+     * @param[in] input                 First unit
+     * @param[in] output                Second unit
+     * @return                          The converters from @ input to @ output and back
+     * @throw     std::invalid_argument Values aren't convertible between the two units
+     * @threadsafety                    Safe
+     * @see ConverterCache::getBidirectional()
+     */
+    static BidirectionalConverter getBidirectionalConverter(const Pimpl& input,
+                                                            const Pimpl& output);
+
+    /**
+     * Returns a converter of numeric values in one unit to another from the process-wide converter
+     * cache without throwing an exception. Inconvertible units are detected before a converter is
+     * created, so they're an inexpensive error.
+     * @param[in] input     Input unit
+     * @param[in] output    Output unit
+     * @return              The converter or the reason it couldn't be obtained
+     * @threadsafety        Safe
+     * @see getConverter()
+     */
+    static ConverterResult tryGetConverter(const Pimpl& input,
+                                           const Pimpl& output) noexcept;
 
     /**
      * Returns a converter of numeric values in this unit to an output unit.
@@ -0,0 +1,837 @@
+/**
+ * This file implements a database of physical quantities and their units.
+ *
+ *        File: UnitDb.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "UnitDb.h"
+
+#include "Exponent.h"
+#include "UnitParser.h"
+
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_set>
+
+#ifdef QUANTITY_HAVE_YAML_CPP
+#include <yaml-cpp/yaml.h>
+#endif
+
+using namespace std;
+
+namespace quantity {
+
+/// Definitions of quantities read from a YAML file. Serialized into a snapshot image.
+struct Spec
+{
+    /// A base quantity
+    struct Base {
+        string name;        ///< Name of the quantity
+        string symbol;      ///< Symbol of the base dimension
+        string unitName;    ///< Name of the base unit
+        string unitSymbol;  ///< Symbol of the base unit
+    };
+
+    /// A factor of the dimensionality of a derived quantity
+    struct Factor {
+        string   quantity;  ///< Name of a base or previously-defined derived quantity
+        Exponent exp;       ///< Power of the quantity
+    };
+
+    /// A derived quantity
+    struct Derived {
+        string         name;        ///< Name of the quantity
+        string         unitName;    ///< Name of the unit. May be empty.
+        string         unitSymbol;  ///< Symbol of the unit. May be empty.
+        vector<Factor> factors;     ///< Factors of the dimensionality
+    };
+
+    /// Types of conversion of a common quantity
+    enum class Type : uint32_t {
+        AFFINE,         ///< parent = slope*value + intercept
+        EXPONENTIATION, ///< parent = reference*base^value
+        UNSUPPORTED     ///< Not supported by the library
+    };
+
+    /// A common quantity
+    struct Common {
+        string name;        ///< Name of the quantity
+        string symbol;      ///< Symbol of the unit. May be empty.
+        string parent;      ///< Name of the parent quantity
+        Type   type;        ///< Type of conversion to the parent quantity
+        double slope;       ///< Slope of an affine conversion
+        double intercept;   ///< Intercept of an affine conversion
+        double base;        ///< Base of an exponentiation
+        double reference;   ///< Reference level of an exponentiation in the parent's unit
+    };
+
+    vector<Base>    bases;      ///< Base quantities
+    vector<Derived> deriveds;   ///< Derived quantities
+    vector<Common>  commons;    ///< Common quantities
+};
+
+/*******************************************************************************
+ * Binary snapshot
+ ******************************************************************************/
+
+/// Magic number of a snapshot
+static const char snapshotMagic[8] = {'Q', 'U', 'A', 'N', 'T', 'D', 'B', '\0'};
+
+/// Version of the snapshot format
+static constexpr uint32_t snapshotVersion = 1;
+
+/// Offset of an absent string
+static constexpr uint32_t noString = UINT32_MAX;
+
+/// Header of a snapshot. Followed by the records and then by the NUL-terminated strings.
+struct SnapshotHeader {
+    char     magic[8];      ///< Magic number
+    uint32_t version;       ///< Format version
+    uint32_t numBases;      ///< Number of base-quantity records
+    uint32_t numDeriveds;   ///< Number of derived-quantity records
+    uint32_t numFactors;    ///< Number of factor records
+    uint32_t numCommons;    ///< Number of common-quantity records
+    uint32_t stringsSize;   ///< Number of bytes of strings
+};
+
+/// Snapshot record of a base quantity. Strings are offsets into the string table.
+struct BaseRecord {
+    uint32_t name;
+    uint32_t symbol;
+    uint32_t unitName;
+    uint32_t unitSymbol;
+};
+
+/// Snapshot record of a derived quantity. Its factors are consecutive factor records.
+struct DerivedRecord {
+    uint32_t name;
+    uint32_t unitName;
+    uint32_t unitSymbol;
+    uint32_t numFactors;
+};
+
+/// Snapshot record of a factor of a derived quantity
+struct FactorRecord {
+    uint32_t quantity;
+    int32_t  numer;
+    int32_t  denom;
+    uint32_t reserved;  ///< Keeps the following records aligned
+};
+
+/// Snapshot record of a common quantity
+struct CommonRecord {
+    uint32_t name;
+    uint32_t symbol;
+    uint32_t parent;
+    uint32_t type;
+    double   slope;
+    double   intercept;
+    double   base;
+    double   reference;
+};
+
+// Every record is a multiple of 16 bytes, so records that follow the header are aligned
+static_assert(sizeof(SnapshotHeader) % 16 == 0, "Snapshot header breaks alignment");
+static_assert(sizeof(BaseRecord) % 16 == 0, "Base record breaks alignment");
+static_assert(sizeof(DerivedRecord) % 16 == 0, "Derived record breaks alignment");
+static_assert(sizeof(FactorRecord) % 16 == 0, "Factor record breaks alignment");
+static_assert(sizeof(CommonRecord) % 16 == 0, "Common record breaks alignment");
+
+/// Builds the string table of a snapshot.
+class StringTable final
+{
+    vector<char> chars; ///< NUL-terminated strings
+
+public:
+    /**
+     * Adds a string.
+     * @param[in] str   The string. May be empty, in which case it's absent.
+     * @return          Offset of the string in the table or `noString`
+     */
+    uint32_t add(const string& str)
+    {
+        if (str.empty())
+            return noString;
+        const auto offset = static_cast<uint32_t>(chars.size());
+        chars.insert(chars.end(), str.c_str(), str.c_str() + str.size() + 1);
+        return offset;
+    }
+
+    /**
+     * Returns the size of the table in bytes.
+     * @return The size of the table in bytes
+     */
+    uint32_t size() const noexcept
+    {
+        return static_cast<uint32_t>(chars.size());
+    }
+
+    /**
+     * Returns the table.
+     * @return The table
+     */
+    const char* data() const noexcept
+    {
+        return chars.data();
+    }
+};
+
+/// A read-only memory mapping of a file. Unmapped on destruction.
+class Mapping final
+{
+    void*  addr;    ///< Start of the mapping
+    size_t size;    ///< Size of the mapping in bytes
+
+public:
+    /**
+     * Constructs.
+     * @param[in] pathname          Pathname of the file
+     * @throw std::runtime_error    The file couldn't be mapped
+     */
+    explicit Mapping(const string& pathname)
+        : addr(MAP_FAILED)
+        , size(0)
+    {
+        const int fd = ::open(pathname.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw runtime_error("Couldn't open \"" + pathname + "\": " + strerror(errno));
+
+        struct stat st;
+        if (::fstat(fd, &st) == 0) {
+            size = static_cast<size_t>(st.st_size);
+            if (size == 0) {
+                ::close(fd);
+                throw runtime_error("\"" + pathname + "\" is empty");
+            }
+            addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        const auto error = errno;
+        ::close(fd);
+        if (addr == MAP_FAILED)
+            throw runtime_error("Couldn't map \"" + pathname + "\": " + strerror(error));
+    }
+
+    Mapping(const Mapping& other) =delete;
+    Mapping& operator=(const Mapping& rhs) =delete;
+
+    /// Destroys. Unmaps the file.
+    ~Mapping() noexcept
+    {
+        ::munmap(addr, size);
+    }
+
+    /**
+     * Returns the start of the mapping.
+     * @return The start of the mapping
+     */
+    const char* data() const noexcept
+    {
+        return static_cast<const char*>(addr);
+    }
+
+    /**
+     * Returns the size of the mapping.
+     * @return The size of the mapping in bytes
+     */
+    size_t length() const noexcept
+    {
+        return size;
+    }
+};
+
+/**
+ * Returns a snapshot image of definitions.
+ * @param[in] spec  The definitions
+ * @return          The snapshot image
+ */
+static vector<char> serialize(const Spec& spec)
+{
+    StringTable           strings;
+    vector<BaseRecord>    bases;
+    vector<DerivedRecord> deriveds;
+    vector<FactorRecord>  factors;
+    vector<CommonRecord>  commons;
+
+    for (const auto& base : spec.bases)
+        bases.push_back(BaseRecord{strings.add(base.name), strings.add(base.symbol),
+                strings.add(base.unitName), strings.add(base.unitSymbol)});
+    for (const auto& derived : spec.deriveds) {
+        deriveds.push_back(DerivedRecord{strings.add(derived.name), strings.add(derived.unitName),
+                strings.add(derived.unitSymbol), static_cast<uint32_t>(derived.factors.size())});
+        for (const auto& factor : derived.factors)
+            factors.push_back(FactorRecord{strings.add(factor.quantity), factor.exp.getNumer(),
+                    factor.exp.getDenom(), 0});
+    }
+    for (const auto& common : spec.commons)
+        commons.push_back(CommonRecord{strings.add(common.name), strings.add(common.symbol),
+                strings.add(common.parent), static_cast<uint32_t>(common.type), common.slope,
+                common.intercept, common.base, common.reference});
+
+    SnapshotHeader header = {};
+    memcpy(header.magic, snapshotMagic, sizeof(header.magic));
+    header.version = snapshotVersion;
+    header.numBases = static_cast<uint32_t>(bases.size());
+    header.numDeriveds = static_cast<uint32_t>(deriveds.size());
+    header.numFactors = static_cast<uint32_t>(factors.size());
+    header.numCommons = static_cast<uint32_t>(commons.size());
+    header.stringsSize = strings.size();
+
+    vector<char> image;
+    const auto   append = [&image](const void* data, const size_t size) {
+        const auto bytes = static_cast<const char*>(data);
+        image.insert(image.end(), bytes, bytes + size);
+    };
+    append(&header, sizeof(header));
+    append(bases.data(), bases.size()*sizeof(BaseRecord));
+    append(deriveds.data(), deriveds.size()*sizeof(DerivedRecord));
+    append(factors.data(), factors.size()*sizeof(FactorRecord));
+    append(commons.data(), commons.size()*sizeof(CommonRecord));
+    append(strings.data(), strings.size());
+    return image;
+}
+
+/**
+ * Writes a snapshot image to a file.
+ * @param[in] image             The snapshot image
+ * @param[in] pathname          Pathname of the snapshot file
+ * @throw std::runtime_error    The file couldn't be written
+ */
+static void writeSnapshot(const vector<char>& image,
+                          const string&       pathname)
+{
+    ofstream out(pathname, ios::binary | ios::trunc);
+    out.write(image.data(), image.size());
+    out.close();
+    if (!out)
+        throw runtime_error("Couldn't write snapshot \"" + pathname + "\"");
+}
+
+/// A validated view of a snapshot image. The records and strings are read in place.
+class SnapshotView final
+{
+    SnapshotHeader       header;    ///< Header of the image
+    const BaseRecord*    bases;     ///< Base-quantity records
+    const DerivedRecord* deriveds;  ///< Derived-quantity records
+    const FactorRecord*  factors;   ///< Factor records
+    const CommonRecord*  commons;   ///< Common-quantity records
+    const char*          strings;   ///< String table
+    string               source;    ///< Pathname of the image's file
+
+public:
+    /**
+     * Constructs.
+     * @param[in] data              The image. Must be aligned for a `double`.
+     * @param[in] size              The size of the image in bytes
+     * @param[in] source            Pathname of the image's file for error messages
+     * @throw std::runtime_error    The image isn't a valid snapshot
+     */
+    SnapshotView(const char*   data,
+                 const size_t  size,
+                 const string& source)
+        : header()
+        , bases(nullptr)
+        , deriveds(nullptr)
+        , factors(nullptr)
+        , commons(nullptr)
+        , strings(nullptr)
+        , source(source)
+    {
+        if (size < sizeof(SnapshotHeader))
+            throw invalid();
+        memcpy(&header, data, sizeof(header));
+        if (memcmp(header.magic, snapshotMagic, sizeof(header.magic)) || header.version !=
+                snapshotVersion)
+            throw invalid();
+
+        const uint64_t recordsSize = uint64_t{header.numBases}*sizeof(BaseRecord) +
+                uint64_t{header.numDeriveds}*sizeof(DerivedRecord) +
+                uint64_t{header.numFactors}*sizeof(FactorRecord) +
+                uint64_t{header.numCommons}*sizeof(CommonRecord);
+        if (sizeof(header) + recordsSize + header.stringsSize != size)
+            throw invalid();
+
+        bases = reinterpret_cast<const BaseRecord*>(data + sizeof(header));
+        deriveds = reinterpret_cast<const DerivedRecord*>(bases + header.numBases);
+        factors = reinterpret_cast<const FactorRecord*>(deriveds + header.numDeriveds);
+        commons = reinterpret_cast<const CommonRecord*>(factors + header.numFactors);
+        strings = reinterpret_cast<const char*>(commons + header.numCommons);
+        if (header.stringsSize && strings[header.stringsSize - 1])
+            throw invalid();
+    }
+
+    /**
+     * Returns the exception for an invalid snapshot.
+     * @return The exception for an invalid snapshot
+     */
+    runtime_error invalid() const
+    {
+        return runtime_error("\"" + source + "\" isn't a valid snapshot");
+    }
+
+    /**
+     * Returns a string of the string table.
+     * @param[in] offset            Offset of the string or `noString`
+     * @return                      The string. Empty if it's absent.
+     * @throw std::runtime_error    The offset is invalid
+     */
+    const char* str(const uint32_t offset) const
+    {
+        if (offset == noString)
+            return "";
+        if (offset >= header.stringsSize)
+            throw invalid();
+        return strings + offset;
+    }
+
+    /**
+     * Returns the header.
+     * @return The header
+     */
+    const SnapshotHeader& getHeader() const noexcept
+    {
+        return header;
+    }
+
+    /**
+     * Returns the base-quantity records.
+     * @return The base-quantity records. There are `getHeader().numBases` of them.
+     */
+    const BaseRecord* getBases() const noexcept
+    {
+        return bases;
+    }
+
+    /**
+     * Returns the derived-quantity records.
+     * @return The derived-quantity records. There are `getHeader().numDeriveds` of them.
+     */
+    const DerivedRecord* getDeriveds() const noexcept
+    {
+        return deriveds;
+    }
+
+    /**
+     * Returns the factor records.
+     * @return The factor records. There are `getHeader().numFactors` of them.
+     */
+    const FactorRecord* getFactors() const noexcept
+    {
+        return factors;
+    }
+
+    /**
+     * Returns the common-quantity records.
+     * @return The common-quantity records. There are `getHeader().numCommons` of them.
+     */
+    const CommonRecord* getCommons() const noexcept
+    {
+        return commons;
+    }
+};
+
+/*******************************************************************************
+ * YAML definition file
+ ******************************************************************************/
+
+#ifdef QUANTITY_HAVE_YAML_CPP
+
+/**
+ * Returns a string-valued entry of a YAML map.
+ * @param[in] map               The map
+ * @param[in] key               The key of the entry
+ * @param[in] required          Whether the entry must exist
+ * @return                      The value of the entry. Empty if it doesn't exist and isn't
+ *                              required.
+ * @throw std::invalid_argument The entry is required but doesn't exist
+ */
+static string getString(const YAML::Node& map,
+                        const char*       key,
+                        const bool        required = true)
+{
+    const auto node = map[key];
+    if (!node) {
+        if (required)
+            throw invalid_argument("Line " + std::to_string(map.Mark().line + 1) +
+                    ": No \"" + key + "\" entry");
+        return string{};
+    }
+    return node.as<string>();
+}
+
+/**
+ * Returns a number-valued entry of a YAML map. The value may be a ratio (e.g., "5.0/9.0") or "e".
+ * @param[in] map               The map
+ * @param[in] key               The key of the entry
+ * @param[in] dflt              The value if the entry doesn't exist
+ * @return                      The value of the entry
+ * @throw std::invalid_argument The value isn't a number
+ */
+static double getNumber(const YAML::Node& map,
+                        const char*       key,
+                        const double      dflt)
+{
+    const auto str = getString(map, key, false);
+    if (str.empty())
+        return dflt;
+    if (str == "e")
+        return std::exp(1.0);
+
+    char*  end;
+    double value = strtod(str.c_str(), &end);
+    if (*end == '/') {
+        const auto start = end + 1;
+        value /= strtod(start, &end);
+        if (end == start)
+            end = const_cast<char*>(str.c_str());
+    }
+    if (end == str.c_str() || *end)
+        throw invalid_argument("Line " + std::to_string(map[key].Mark().line + 1) +
+                ": Invalid number: \"" + str + "\"");
+    return value;
+}
+
+/**
+ * Returns an exponent-valued entry of a YAML map. The value may be an integer or a ratio of
+ * integers (e.g., "1/2").
+ * @param[in] map               The map
+ * @param[in] key               The key of the entry
+ * @return                      The value of the entry. One if it doesn't exist.
+ * @throw std::invalid_argument The value isn't a valid exponent
+ */
+static Exponent getExponent(const YAML::Node& map,
+                            const char*       key)
+{
+    const auto str = getString(map, key, false);
+    if (str.empty())
+        return Exponent(1);
+    const auto invalid = [&] {
+        return invalid_argument("Line " + std::to_string(map[key].Mark().line + 1) +
+                ": Invalid power: \"" + str + "\"");
+    };
+
+    char* end;
+    errno = 0;
+    const auto numer = strtoll(str.c_str(), &end, 10);
+    long long  denom = 1;
+    if (end != str.c_str() && *end == '/') {
+        const auto start = end + 1;
+        denom = strtoll(start, &end, 10);
+        if (end == start)
+            end = const_cast<char*>(str.c_str());
+    }
+    if (end == str.c_str() || *end || errno)
+        throw invalid();
+    try {
+        return Exponent(numer, denom);
+    }
+    catch (const exception& ex) {
+        throw invalid(); // Zero denominator or too large
+    }
+}
+
+/**
+ * Reads a YAML definition file.
+ * @param[in] pathname          Pathname of the file
+ * @return                      The definitions
+ * @throw std::runtime_error    The file couldn't be read or parsed
+ * @throw std::invalid_argument The definitions are invalid
+ */
+static Spec readYaml(const string& pathname)
+{
+    YAML::Node doc;
+    try {
+        doc = YAML::LoadFile(pathname);
+    }
+    catch (const YAML::Exception& ex) {
+        throw runtime_error("Couldn't load \"" + pathname + "\": " + ex.what());
+    }
+
+    Spec spec;
+
+    for (const auto& node : doc["base_quantities"]) {
+        const auto unit = node["unit"];
+        if (!unit)
+            throw invalid_argument("Line " + std::to_string(node.Mark().line + 1) +
+                    ": Base quantity has no unit");
+        spec.bases.push_back(Spec::Base{getString(node, "name"),
+                getString(node, "symbol"), getString(unit, "name"), getString(unit, "symbol")});
+    }
+
+    for (const auto& node : doc["derived_quantities"]) {
+        Spec::Derived derived{getString(node, "name"), "", "", {}};
+        if (const auto unit = node["unit"]) {
+            derived.unitName = getString(unit, "name");
+            derived.unitSymbol = getString(unit, "symbol", false);
+        }
+        for (const auto& factor : node["dimensionality"])
+            derived.factors.push_back(Spec::Factor{getString(factor, "quantity"),
+                    getExponent(factor, "power")});
+        spec.deriveds.push_back(derived);
+    }
+
+    for (const auto& node : doc["common_quantities"]) {
+        const auto conversion = node["conversion"];
+        if (!conversion)
+            throw invalid_argument("Line " + std::to_string(node.Mark().line + 1) +
+                    ": Common quantity has no conversion");
+        const auto typeName = getString(conversion, "type");
+        const auto type = typeName == "affine"
+                ? Spec::Type::AFFINE
+                : typeName == "exponentiation"
+                      ? Spec::Type::EXPONENTIATION
+                      : Spec::Type::UNSUPPORTED;
+        const auto isSupported = type != Spec::Type::UNSUPPORTED;
+        spec.commons.push_back(Spec::Common{getString(node, "name"),
+                getString(node, "symbol", false), getString(node, "parent"), type,
+                isSupported ? getNumber(conversion, "slope", 1) : 1,
+                isSupported ? getNumber(conversion, "intercept", 0) : 0,
+                isSupported ? getNumber(conversion, "base", 10) : 10,
+                isSupported ? getNumber(conversion, "reference", 1) : 1});
+    }
+
+    return spec;
+}
+
+bool UnitDb::haveYaml() noexcept
+{
+    return true;
+}
+
+#else
+
+/**
+ * Reads a YAML definition file.
+ * @throw std::logic_error  Always. The library was built without yaml-cpp.
+ */
+static Spec readYaml(const string&)
+{
+    throw logic_error("Can't read YAML definition files: library was built without yaml-cpp");
+}
+
+bool UnitDb::haveYaml() noexcept
+{
+    return false;
+}
+
+#endif
+
+/*******************************************************************************
+ * Database
+ ******************************************************************************/
+
+size_t UnitDb::StrHash::operator()(const char* str) const noexcept
+{
+    // FNV-1a
+    static const auto prime = static_cast<size_t>(UINT64_C(1099511628211));
+    auto              hash = static_cast<size_t>(UINT64_C(14695981039346656037));
+    for (; *str; ++str)
+        hash = (hash ^ static_cast<unsigned char>(*str))*prime;
+    return hash;
+}
+
+bool UnitDb::StrEqual::operator()(const char* lhs, const char* rhs) const noexcept
+{
+    return ::strcmp(lhs, rhs) == 0;
+}
+
+UnitDb::UnitDb(const shared_ptr<const char>& image,
+               const size_t                  size,
+               const string&                 source)
+    : image(image)
+    , baseInfos()
+    , quantities()
+    , dimSymbols()
+    , unitNames()
+    , unitSymbols()
+    , unsupported()
+{
+    const SnapshotView view(image.get(), size, source);
+    const auto&        header = view.getHeader();
+
+    // The strings are those of the image, so the tables' keys are never copied
+    const auto addQuantity = [&](const char* name, const Dimensionality& dim,
+            const Unit::Pimpl& unit) {
+        if (!quantities.insert({name, Quantity{dim, unit}}).second)
+            throw invalid_argument(string("Quantity \"") + name + "\" is defined more than once");
+    };
+    const auto addUnit = [&](const char* name, const char* symbol, const Unit::Pimpl& unit) {
+        if (*name)
+            unitNames[name] = unit;
+        if (*symbol)
+            unitSymbols[symbol] = unit;
+    };
+    const auto getQuantity = [&](const char* name, const char* user) -> const Quantity& {
+        const auto iter = quantities.find(name);
+        if (iter == quantities.end())
+            throw invalid_argument(string("Quantity \"") + user +
+                    "\" refers to unknown quantity \"" + name + "\"");
+        return iter->second;
+    };
+
+    baseInfos.reserve(header.numBases);
+    for (auto base = view.getBases(); base != view.getBases() + header.numBases; ++base) {
+        const auto name = view.str(base->name);
+        const auto symbol = view.str(base->symbol);
+        const auto unitName = view.str(base->unitName);
+        const auto unitSymbol = view.str(base->unitSymbol);
+        const auto dim = Dimensionality::get(name, symbol);
+        baseInfos.emplace_back(dim, unitName, unitSymbol);
+        const auto unit = Unit::get(baseInfos.back());
+        addQuantity(name, dim, unit);
+        addUnit(unitName, unitSymbol, unit);
+        dimSymbols[symbol] = dim;
+    }
+
+    auto factor = view.getFactors();
+    const auto endFactors = factor + header.numFactors;
+    for (auto derived = view.getDeriveds(); derived != view.getDeriveds() + header.numDeriveds;
+            ++derived) {
+        const auto name = view.str(derived->name);
+        if (derived->numFactors > static_cast<size_t>(endFactors - factor))
+            throw view.invalid();
+        if (derived->numFactors == 0)
+            throw invalid_argument(string("Quantity \"") + name + "\" has no dimensionality");
+        const auto end = factor + derived->numFactors;
+        Exponent    exp(factor->numer, factor->denom);
+        const auto& first = getQuantity(view.str(factor->quantity), name);
+        auto        dim = first.dim.pow(exp);
+        auto        unit = first.unit->pow(exp);
+        while (++factor != end) {
+            exp = Exponent(factor->numer, factor->denom);
+            const auto& quantity = getQuantity(view.str(factor->quantity), name);
+            dim = dim.multiply(quantity.dim.pow(exp));
+            unit = unit->multiply(quantity.unit->pow(exp));
+        }
+        addQuantity(name, dim, unit);
+        addUnit(view.str(derived->unitName), view.str(derived->unitSymbol), unit);
+    }
+
+    unordered_set<const char*, StrHash, StrEqual> skipped;
+    for (auto common = view.getCommons(); common != view.getCommons() + header.numCommons;
+            ++common) {
+        if (common->type > static_cast<uint32_t>(Spec::Type::UNSUPPORTED))
+            throw view.invalid();
+        const auto name = view.str(common->name);
+        const auto parentName = view.str(common->parent);
+        const auto type = static_cast<Spec::Type>(common->type);
+        if (type == Spec::Type::UNSUPPORTED || skipped.count(parentName)) {
+            skipped.insert(name);
+            unsupported.push_back(name);
+            continue;
+        }
+
+        const auto& parent = getQuantity(parentName, name);
+        Unit::Pimpl unit;
+        Dimensionality dim;
+        if (type == Spec::Type::AFFINE) {
+            if (common->slope == 0)
+                throw invalid_argument(string("Quantity \"") + name + "\" has a zero slope");
+            unit = Unit::get(parent.unit, 1/common->slope, -common->intercept/common->slope);
+            dim = parent.dim;
+        }
+        else {
+            Unit::BaseEnum base;
+            if (common->base == 2) {
+                base = Unit::BaseEnum::TWO;
+            }
+            else if (common->base == 10) {
+                base = Unit::BaseEnum::TEN;
+            }
+            else if (std::abs(common->base - std::exp(1.0)) < 1e-12) {
+                base = Unit::BaseEnum::E;
+            }
+            else {
+                throw invalid_argument(string("Quantity \"") + name + "\" has an unsupported "
+                        "logarithmic base");
+            }
+            if (common->reference <= 0)
+                throw invalid_argument(string("Quantity \"") + name + "\" has a non-positive "
+                        "reference level");
+            unit = Unit::get(base, Unit::get(parent.unit, 1/common->reference, 0));
+        }
+        addQuantity(name, dim, unit);
+        addUnit(name, view.str(common->symbol), unit);
+    }
+}
+
+UnitDb UnitDb::fromYaml(const string& pathname)
+{
+    // The image is kept by the database, so it's shared with its buffer
+    const auto buffer = make_shared<const vector<char>>(serialize(readYaml(pathname)));
+    return UnitDb(shared_ptr<const char>(buffer, buffer->data()), buffer->size(), pathname);
+}
+
+void UnitDb::compile(const string& yamlPathname,
+                     const string& snapshotPathname)
+{
+    writeSnapshot(serialize(readYaml(yamlPathname)), snapshotPathname);
+}
+
+UnitDb UnitDb::fromSnapshot(const string& pathname)
+{
+    // The mapping is kept by the database: the strings of its tables are those of the mapping
+    const auto mapping = make_shared<const Mapping>(pathname);
+    return UnitDb(shared_ptr<const char>(mapping, mapping->data()), mapping->length(), pathname);
+}
+
+Dimensionality UnitDb::getDimensionality(const string& name) const
+{
+    return quantities.at(name.c_str()).dim;
+}
+
+Unit::Pimpl UnitDb::getQuantityUnit(const string& name) const
+{
+    return quantities.at(name.c_str()).unit;
+}
+
+Unit::Pimpl UnitDb::getUnit(const string& nameOrSymbol) const
+{
+    auto iter = unitSymbols.find(nameOrSymbol.c_str());
+    if (iter != unitSymbols.end())
+        return iter->second;
+    iter = unitNames.find(nameOrSymbol.c_str());
+    if (iter != unitNames.end())
+        return iter->second;
+    throw out_of_range("No such unit: \"" + nameOrSymbol + "\"");
+}
+
+const vector<string>& UnitDb::getUnsupported() const noexcept
+{
+    return unsupported;
+}
+
+void UnitDb::define(UnitParser& parser) const
+{
+    for (const auto& entry : unitSymbols)
+        parser.define(entry.first, entry.second);
+    for (const auto& entry : dimSymbols)
+        parser.define(entry.first, entry.second);
+}
+
+} // namespace quantity
@@ -0,0 +1,176 @@
+/**
+ * This file declares a database of physical quantities and their units.
+ *
+ *        File: UnitDb.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "BaseInfo.h"
+#include "Dimensionality.h"
+#include "Unit.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace quantity {
+
+class UnitParser;
+
+/**
+ * A database of physical quantities and their units. It's built from a YAML definition file like
+ * src/quantities.yaml or from a binary snapshot of one. Building it creates the base dimensions
+ * and base units that the file defines, so only one database with a given base unit can exist at a
+ * time.
+ *
+ * A snapshot is a compact, position-independent image of the definitions whose records are read in
+ * place from a memory mapping, so loading one involves neither YAML parsing nor the allocation of a
+ * document tree. The database keeps the image, whose strings key its tables, so the strings aren't
+ * copied either. A YAML definition file is compiled into such an image in memory. Snapshots use the
+ * byte order of the machine that wrote them.
+ *
+ * Quantities whose conversion the library doesn't support (e.g., "temporal") are skipped, as are
+ * quantities derived from them; their names are available from getUnsupported().
+ * @threadsafety Compatible
+ */
+class UnitDb final
+{
+    /// A quantity
+    struct Quantity {
+        Dimensionality dim;     ///< Dimensionality of the quantity
+        Unit::Pimpl    unit;    ///< Unit of the quantity
+    };
+
+    /// Hashes a NUL-terminated string
+    struct StrHash {
+        size_t operator()(const char* str) const noexcept;
+    };
+
+    /// Compares NUL-terminated strings for equality
+    struct StrEqual {
+        bool operator()(const char* lhs, const char* rhs) const noexcept;
+    };
+
+    /// Type of a table keyed by strings of the snapshot image
+    template<typename T>
+    using StrMap = std::unordered_map<const char*, T, StrHash, StrEqual>;
+
+    std::shared_ptr<const char> image;       ///< Snapshot image. Holds the keys of the tables.
+    std::vector<BaseInfo>       baseInfos;   ///< Base unit information
+    StrMap<Quantity>            quantities;  ///< Quantities by name
+    StrMap<Dimensionality>      dimSymbols;  ///< Base dimensions by symbol
+    StrMap<Unit::Pimpl>         unitNames;   ///< Units by name
+    StrMap<Unit::Pimpl>         unitSymbols; ///< Units by symbol
+    std::vector<std::string>    unsupported; ///< Skipped quantities
+
+    /**
+     * Constructs from a snapshot image. The records are read in place and the image is kept.
+     * @param[in] image             The image
+     * @param[in] size              The size of the image in bytes
+     * @param[in] source            Pathname of the image's file for error messages
+     * @throw std::runtime_error    The image isn't a valid snapshot
+     * @throw std::invalid_argument The definitions are invalid
+     */
+    UnitDb(const std::shared_ptr<const char>& image,
+           const size_t                       size,
+           const std::string&                 source);
+
+public:
+    /**
+     * Indicates if YAML definition files can be read. They can if the library was built with the
+     * yaml-cpp library.
+     * @retval true     YAML definition files can be read
+     * @retval false    YAML definition files can't be read
+     */
+    static bool haveYaml() noexcept;
+
+    /**
+     * Returns a database built from a YAML definition file.
+     * @param[in] pathname          Pathname of the file
+     * @return                      The corresponding database
+     * @throw std::runtime_error    The file couldn't be read or parsed
+     * @throw std::invalid_argument The definitions are invalid
+     * @throw std::logic_error      The library was built without yaml-cpp
+     * @see haveYaml()
+     */
+    static UnitDb fromYaml(const std::string& pathname);
+
+    /**
+     * Writes a binary snapshot of a YAML definition file. The definitions are only vetted when the
+     * snapshot is loaded.
+     * @param[in] yamlPathname      Pathname of the YAML definition file
+     * @param[in] snapshotPathname  Pathname of the snapshot file
+     * @throw std::runtime_error    A file couldn't be read, parsed, or written
+     * @throw std::invalid_argument The definitions are invalid
+     * @throw std::logic_error      The library was built without yaml-cpp
+     */
+    static void compile(const std::string& yamlPathname,
+                        const std::string& snapshotPathname);
+
+    /**
+     * Returns a database built from a binary snapshot.
+     * @param[in] pathname          Pathname of the snapshot
+     * @return                      The corresponding database
+     * @throw std::runtime_error    The file couldn't be mapped or isn't a valid snapshot
+     * @throw std::invalid_argument The definitions are invalid
+     */
+    static UnitDb fromSnapshot(const std::string& pathname);
+
+    /**
+     * Returns the dimensionality of a quantity.
+     * @param[in] name          Name of the quantity (e.g., "power")
+     * @return                  The dimensionality of the quantity
+     * @throw std::out_of_range No such quantity
+     */
+    Dimensionality getDimensionality(const std::string& name) const;
+
+    /**
+     * Returns the unit of a quantity.
+     * @param[in] name          Name of the quantity (e.g., "degrees celsius")
+     * @return                  The unit of the quantity
+     * @throw std::out_of_range No such quantity
+     */
+    Unit::Pimpl getQuantityUnit(const std::string& name) const;
+
+    /**
+     * Returns a unit.
+     * @param[in] nameOrSymbol  Name or symbol of the unit (e.g., "watt" or "W")
+     * @return                  The unit
+     * @throw std::out_of_range No such unit
+     */
+    Unit::Pimpl getUnit(const std::string& nameOrSymbol) const;
+
+    /**
+     * Returns the names of the quantities that were skipped because their conversion isn't
+     * supported.
+     * @return The names of the skipped quantities in definition order
+     */
+    const std::vector<std::string>& getUnsupported() const noexcept;
+
+    /**
+     * Defines the unit symbols and base dimension symbols of this database in a parser.
+     * @param[in,out] parser    The parser
+     */
+    void define(UnitParser& parser) const;
+};
+
+} // namespace quantity
@@ -0,0 +1,495 @@
+/**
+ * This file implements a parser of unit specifications.
+ *
+ *        File: UnitParser.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "UnitParser.h"
+
+#include "Exponent.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+namespace quantity {
+
+/**
+ * Indicates if a string starts with the UTF-8 encoding of the multiplication dot ("·").
+ * @param[in] str   The string
+ * @retval true     The string starts with a multiplication dot
+ * @retval false    The string doesn't start with a multiplication dot
+ */
+static inline bool isDot(const char* str)
+{
+    return str[0] == '\xC2' && str[1] == '\xB7';
+}
+
+/**
+ * Indicates if a string starts with a character that may be part of a symbol.
+ * @param[in] str   The string
+ * @retval true     The character may be part of a symbol
+ * @retval false    The character may not be part of a symbol
+ */
+static inline bool isSymbolChar(const char* str)
+{
+    const auto c = *str;
+    return c != 0 && !isspace(static_cast<unsigned char>(c)) && strchr("^()+-", c) == nullptr &&
+            !isDot(str);
+}
+
+/**
+ * Indicates if a string starts with a character that may start a symbol.
+ * @param[in] str   The string
+ * @retval true     The character may start a symbol
+ * @retval false    The character may not start a symbol
+ */
+static inline bool isSymbolStart(const char* str)
+{
+    return isSymbolChar(str) && !isdigit(static_cast<unsigned char>(*str)) && *str != '.';
+}
+
+/**
+ * Vets a symbol.
+ * @param[in] symbol            The symbol
+ * @throw std::invalid_argument The symbol isn't valid
+ */
+static void vet(const string& symbol)
+{
+    const char* str = symbol.c_str();
+    if (!isSymbolStart(str))
+        throw invalid_argument("Invalid symbol: \"" + symbol + "\"");
+    while (*str) {
+        if (!isSymbolChar(str))
+            throw invalid_argument("Invalid symbol: \"" + symbol + "\"");
+        str += isDot(str) ? 2 : 1;
+    }
+}
+
+/// A recursive-descent parser of one specification. Works in place on the specification.
+class UnitParser::Parser final
+{
+    const Symbols&    tables;   ///< Definitions of symbols
+    const string&     spec;     ///< The specification
+    const char*       next;     ///< Next character to parse
+
+    /**
+     * Throws an exception describing a syntax error at the current position.
+     * @param[in] reason            Description of the error
+     * @throw std::invalid_argument Always
+     */
+    [[noreturn]] void fail(const string& reason) const
+    {
+        throw invalid_argument("Invalid unit specification \"" + spec + "\" at offset " +
+                std::to_string(next - spec.c_str()) + ": " + reason);
+    }
+
+    /// Skips whitespace.
+    void skipSpace() noexcept
+    {
+        while (isspace(static_cast<unsigned char>(*next)))
+            ++next;
+    }
+
+    /**
+     * Indicates if the unparsed specification starts with a string.
+     * @param[in] str   The string
+     * @retval true     The unparsed specification starts with the string
+     * @retval false    The unparsed specification doesn't start with the string
+     */
+    bool lookingAt(const char* str) const noexcept
+    {
+        return strncmp(next, str, strlen(str)) == 0;
+    }
+
+    /**
+     * Consumes a character.
+     * @param[in] c                 The character
+     * @throw std::invalid_argument The next character isn't @ c
+     */
+    void expect(const char c)
+    {
+        if (*next != c)
+            fail(string("Expected \"") + c + "\"");
+        ++next;
+    }
+
+    /**
+     * Indicates if the unparsed specification starts with a number.
+     * @retval true     The unparsed specification starts with a number
+     * @retval false    The unparsed specification doesn't start with a number
+     */
+    bool atNumber() const noexcept
+    {
+        auto str = next;
+        if (*str == '-' || *str == '+')
+            ++str;
+        if (*str == '.')
+            ++str;
+        return isdigit(static_cast<unsigned char>(*str));
+    }
+
+    /**
+     * Consumes a floating-point number.
+     * @return                      The number
+     * @throw std::invalid_argument The unparsed specification doesn't start with a number
+     */
+    double number()
+    {
+        if (!atNumber())
+            fail("Expected number");
+        char* end;
+        const auto value = strtod(next, &end);
+        next = end;
+        return value;
+    }
+
+    /**
+     * Consumes an integer.
+     * @return                      The integer
+     * @throw std::invalid_argument The unparsed specification doesn't start with an integer
+     */
+    long integer()
+    {
+        char* end;
+        const auto value = strtol(next, &end, 10);
+        if (end == next)
+            fail("Expected integer");
+        next = end;
+        return value;
+    }
+
+    /**
+     * Consumes an exponent: an integer or a parenthesized ratio of integers.
+     * @return                      The exponent
+     * @throw std::invalid_argument The exponent is invalid
+     */
+    Exponent exponent()
+    {
+        long numer;
+        long denom = 1;
+        if (*next == '(') {
+            ++next;
+            numer = integer();
+            expect('/');
+            denom = integer();
+            expect(')');
+        }
+        else {
+            numer = integer();
+        }
+
+        try {
+            return Exponent(numer, denom);
+        }
+        catch (const exception& ex) {
+            fail(ex.what());
+        }
+    }
+
+    /**
+     * Consumes a symbol.
+     * @return                      The symbol
+     * @throw std::invalid_argument The unparsed specification doesn't start with a symbol
+     */
+    string symbol()
+    {
+        if (!isSymbolStart(next))
+            fail("Expected symbol");
+        const auto start = next;
+        while (isSymbolChar(next))
+            ++next;
+        return string(start, next);
+    }
+
+    /**
+     * Consumes a dimension symbol and its optional exponent. An exponent of zero that's followed by
+     * a closing parenthesis isn't consumed because it ends an unreferenced logarithmic unit.
+     * @return                      The corresponding dimensionality
+     * @throw std::invalid_argument The symbol isn't defined
+     */
+    Dimensionality dimFactor()
+    {
+        const auto iter = tables.dims.find(symbol());
+        if (iter == tables.dims.end())
+            fail("Undefined dimension symbol");
+        if (*next == '^' && !(next[1] == '0' && next[2] == ')')) {
+            ++next;
+            return iter->second.pow(exponent());
+        }
+        return iter->second;
+    }
+
+    /**
+     * Consumes a product of dimensions.
+     * @return The corresponding dimensionality
+     */
+    Dimensionality dimProduct()
+    {
+        auto dim = dimFactor();
+        while (isDot(next)) {
+            next += 2;
+            dim = dim.multiply(dimFactor());
+        }
+        return dim;
+    }
+
+    /**
+     * Consumes a unit symbol and its optional exponent.
+     * @return                      The corresponding unit
+     * @throw std::invalid_argument The symbol isn't defined
+     */
+    Unit::Pimpl factor()
+    {
+        const auto iter = tables.units.find(symbol());
+        if (iter == tables.units.end())
+            fail("Undefined unit symbol");
+        if (*next == '^') {
+            ++next;
+            return iter->second->pow(exponent());
+        }
+        return iter->second;
+    }
+
+    /**
+     * Consumes a product of units.
+     * @return The corresponding unit
+     */
+    Unit::Pimpl product()
+    {
+        auto unit = factor();
+        while (isDot(next)) {
+            next += 2;
+            unit = unit->multiply(factor());
+        }
+        return unit;
+    }
+
+    /**
+     * Consumes a logarithmic unit after its "lb", "ln", or "lg" prefix.
+     * @param[in] base  The logarithmic base
+     * @return          The corresponding logarithmic unit
+     */
+    Unit::Pimpl logUnit(const Unit::BaseEnum base)
+    {
+        expect('(');
+        if (lookingAt("re ")) {
+            next += 3;
+            const auto refLevel = unit();
+            skipSpace();
+            expect(')');
+            return Unit::get(base, refLevel);
+        }
+
+        Dimensionality dim;
+        if (*next == '(') {
+            ++next;
+            dim = dimProduct();
+            expect(')');
+        }
+        else {
+            dim = dimProduct();
+        }
+        if (!lookingAt("^0)"))
+            fail("Expected \"^0)\"");
+        next += 3;
+        return Unit::get(base, dim);
+    }
+
+    /**
+     * Consumes a parenthesized unit, a logarithmic unit, or a product of units.
+     * @return The corresponding unit
+     */
+    Unit::Pimpl primary()
+    {
+        if (*next == '(') {
+            ++next;
+            const auto result = unit();
+            skipSpace();
+            expect(')');
+            return result;
+        }
+        if (next[0] == 'l' && next[1] && next[2] == '(') {
+            switch (next[1]) {
+                case 'b': next += 2; return logUnit(Unit::BaseEnum::TWO);
+                case 'n': next += 2; return logUnit(Unit::BaseEnum::E);
+                case 'g': next += 2; return logUnit(Unit::BaseEnum::TEN);
+                default: break;
+            }
+        }
+        return product();
+    }
+
+    /**
+     * Consumes a unit with an optional slope and intercept.
+     * @return The corresponding unit
+     */
+    Unit::Pimpl unit()
+    {
+        skipSpace();
+        double slope = 1;
+        if (atNumber()) {
+            slope = number();
+            skipSpace();
+        }
+
+        const auto core = primary();
+
+        double     intercept = 0;
+        const auto afterCore = next;
+        skipSpace();
+        if (*next == '+' || *next == '-') {
+            const auto sign = (*next++ == '-') ? -1 : 1;
+            skipSpace();
+            intercept = sign*number();
+        }
+        else {
+            next = afterCore;
+        }
+
+        return Unit::get(core, slope, intercept);
+    }
+
+public:
+    /**
+     * Constructs.
+     * @param[in] tables    Definitions of symbols
+     * @param[in] spec      The specification to parse
+     */
+    Parser(const Symbols& tables,
+           const string&  spec)
+        : tables(tables)
+        , spec(spec)
+        , next(spec.c_str())
+    {}
+
+    /**
+     * Parses the specification.
+     * @return                      The corresponding unit
+     * @throw std::invalid_argument The specification is invalid
+     */
+    Unit::Pimpl parse()
+    {
+        const auto result = unit();
+        skipSpace();
+        if (*next)
+            fail("Unexpected character");
+        return result;
+    }
+};
+
+UnitParser::UnitParser(const size_t capacity)
+    : symbols()
+    , lock()
+    , lru()
+    , index()
+    , capacity(capacity)
+    , generation(0)
+    , hits(0)
+    , misses(0)
+{
+    if (capacity == 0)
+        throw invalid_argument("Unit parser cache capacity is zero");
+}
+
+void UnitParser::invalidate()
+{
+    // After the symbols are published, so a parse that starts afterwards sees them
+    lock_guard<mutex> guard{lock};
+    ++generation;
+    index.clear();
+    lru.clear();
+}
+
+void UnitParser::define(const string&      symbol,
+                        const Unit::Pimpl& unit)
+{
+    vet(symbol);
+    symbols.update([&](Symbols& syms) {
+        syms.units[symbol] = unit;
+    });
+    invalidate();
+}
+
+void UnitParser::define(const BaseInfo& baseInfo)
+{
+    define(baseInfo.to_string(), Unit::get(baseInfo));
+}
+
+void UnitParser::define(const string&         symbol,
+                        const Dimensionality& dim)
+{
+    vet(symbol);
+    symbols.update([&](Symbols& syms) {
+        syms.dims[symbol] = dim;
+    });
+    invalidate();
+}
+
+Unit::Pimpl UnitParser::parse(const string& spec)
+{
+    uint64_t startGeneration;
+    {
+        lock_guard<mutex> guard{lock};
+        auto              iter = index.find(spec);
+        if (iter != index.end()) {
+            ++hits;
+            lru.splice(lru.begin(), lru, iter->second);
+            return iter->second->second;
+        }
+        ++misses;
+        startGeneration = generation;
+    }
+
+    auto unit = symbols.read([&](const Symbols& syms) {
+        return Parser(syms, spec).parse();
+    });
+
+    lock_guard<mutex> guard{lock};
+    // Another thread might have cached the same specification meanwhile, and a result parsed with
+    // symbols that have since been redefined mustn't be cached
+    if (generation == startGeneration && index.find(spec) == index.end()) {
+        if (lru.size() >= capacity) {
+            index.erase(lru.back().first);
+            lru.pop_back();
+        }
+        lru.emplace_front(spec, unit);
+        index.emplace(spec, lru.begin());
+    }
+    return unit;
+}
+
+UnitParser::Stats UnitParser::getStats() const
+{
+    lock_guard<mutex> guard{lock};
+    return Stats{hits, misses, lru.size()};
+}
+
+void UnitParser::clear()
+{
+    lock_guard<mutex> guard{lock};
+    index.clear();
+    lru.clear();
+    hits = misses = 0;
+}
+
+} // namespace quantity
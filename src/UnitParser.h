@@ -0,0 +1,151 @@
+/**
+ * This file declares a parser of unit specifications.
+ *
+ *        File: UnitParser.h
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "BaseInfo.h"
+#include "Dimensionality.h"
+#include "Snapshot.h"
+#include "Unit.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace quantity {
+
+/**
+ * A parser of unit specifications. It accepts the forms that the to_string() functions of the unit
+ * classes produce:
+ *
+ *   - Canonical units: symbols with optional exponents joined by "·" (e.g., "kg·m^2·s^-3" or
+ *     "m^(1/2)");
+ *   - Affine units: an optional slope, a unit, and an optional intercept (e.g., "K + 273.15",
+ *     "0.3048 m", or "1.8 (lg(re m)) - 3");
+ *   - Referenced logarithmic units (e.g., "lg(re 1 mW)" or "ln(re m·s^-1)"); and
+ *   - Unreferenced logarithmic units (e.g., "lb(L^0)" or "lg((L·T^-1)^0)").
+ *
+ * Symbols are defined by the user and may be any sequence of characters other than whitespace,
+ * "·", "^", "(", ")", "+", and "-" that doesn't start with a digit or "." (e.g., "°C"). Results
+ * are kept in a least-recently-used cache keyed by the specification, so parsing a specification
+ * again costs one hash lookup. The cache's lock is only held to look up and insert results, not
+ * while parsing, so concurrent callers parse in parallel.
+ * @threadsafety Safe
+ */
+class UnitParser final
+{
+public:
+    /// Statistics of the cache of a parser
+    struct Stats {
+        uint64_t hits;      ///< Number of parses satisfied by the cache
+        uint64_t misses;    ///< Number of parses not satisfied by the cache
+        size_t   size;      ///< Current number of cache entries
+    };
+
+private:
+    using Entry = std::pair<std::string, Unit::Pimpl>;           ///< Cache entry
+    using List = std::list<Entry>;                               ///< Type of LRU list
+    using Index = std::unordered_map<std::string, List::iterator>; ///< Type of cache index
+
+    /// Definitions of symbols
+    struct Symbols {
+        std::unordered_map<std::string, Unit::Pimpl>    units;  ///< Units by symbol
+        std::unordered_map<std::string, Dimensionality> dims;   ///< Dimensionalities by symbol
+    };
+
+    Snapshot<Symbols>  symbols;    ///< Definitions of symbols. Read without locking while parsing.
+    mutable std::mutex lock;       ///< Protects the cache and its statistics
+    List               lru;        ///< Most- to least-recently used
+    Index              index;      ///< Index of the cache
+    const size_t       capacity;   ///< Maximum number of entries
+    uint64_t           generation; ///< Number of times the symbols have been redefined
+    uint64_t           hits;       ///< Number of cache hits
+    uint64_t           misses;     ///< Number of cache misses
+
+    /// Clears the cache because the symbols have changed.
+    void invalidate();
+
+    class Parser;
+
+public:
+    /// Default maximum number of cached specifications
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    /**
+     * Constructs. No symbols are defined.
+     * @param[in] capacity          Maximum number of cached specifications
+     * @throw std::invalid_argument @ capacity is zero
+     */
+    explicit UnitParser(const size_t capacity = DEFAULT_CAPACITY);
+
+    UnitParser(const UnitParser& other) =delete;
+    UnitParser& operator=(const UnitParser& rhs) =delete;
+
+    /**
+     * Defines a symbol for a unit. Clears the cache.
+     * @param[in] symbol            The symbol
+     * @param[in] unit              The unit
+     * @throw std::invalid_argument @ symbol isn't a valid symbol
+     */
+    void define(const std::string& symbol,
+                const Unit::Pimpl& unit);
+
+    /**
+     * Defines the symbol of a base unit as that base unit. Clears the cache.
+     * @param[in] baseInfo          The base unit
+     * @throw std::invalid_argument The symbol of the base unit isn't a valid symbol
+     */
+    void define(const BaseInfo& baseInfo);
+
+    /**
+     * Defines a symbol for a dimensionality for use in unreferenced logarithmic units. Clears the
+     * cache.
+     * @param[in] symbol            The symbol
+     * @param[in] dim               The dimensionality
+     * @throw std::invalid_argument @ symbol isn't a valid symbol
+     */
+    void define(const std::string&    symbol,
+                const Dimensionality& dim);
+
+    /**
+     * Returns the unit corresponding to a specification.
+     * @param[in] spec              The specification
+     * @return                      The corresponding unit
+     * @throw std::invalid_argument The specification is invalid or contains an undefined symbol
+     */
+    Unit::Pimpl parse(const std::string& spec);
+
+    /**
+     * Returns the statistics of the cache.
+     * @return The statistics of the cache
+     */
+    Stats getStats() const;
+
+    /// Removes all cache entries and zeros the statistics.
+    void clear();
+};
+
+} // namespace quantity
@@ -25,7 +25,7 @@
 #include "AffineUnit.h"
 #include "CanonicalUnit.h"
 #include "Converter.h"
-#include "ConverterImpl.h"
+#include "ConverterIr.h"
 #include "Dimensionality.h"
 
 #include <cfloat>
@@ -39,26 +39,6 @@ using namespace std;
 
 namespace quantity {
 
-/// Converter of numeric values in an input unit to an unreferenced logarithmic unit.
-class UnrefLogUnit::FromConverter : public ConverterImpl {
-private:
-    const double    inputLogBase;   ///< Natural logarithm of the input unit's base
-    const double    outputLogBase;  ///< Natural logarithm of the output unit's base
-public:
-    /**
-     * Constructs.
-     * @param[in] inputLogBase      Natural logarithm of the input unit's base
-     * @param[in] outputLogBase     Natural logarithm of the output unit's base
-     */
-    FromConverter(const double inputLogBase, const double outputLogBase)
-        : inputLogBase(inputLogBase)
-        , outputLogBase(outputLogBase)
-    {}
-    double operator()(const double value) const override {
-        return value*(inputLogBase/outputLogBase);
-    }
-};
-
 UnrefLogUnit::UnrefLogUnit(const BaseEnum         base,
                            const Dimensionality& dims)
     : LogUnit(base)
@@ -109,6 +89,8 @@ size_t UnrefLogUnit::hash() const
 
 int UnrefLogUnit::compare(const Pimpl& other) const
 {
+    if (other.get() == this)
+        return 0;
     return -other->compareTo(*this);
 }
 
@@ -136,27 +118,29 @@ int UnrefLogUnit::compareTo(const UnrefLogUnit& other) const
               : dims.compare(other.dims);
 }
 
-bool UnrefLogUnit::isConvertible(const Pimpl& other) const
+bool UnrefLogUnit::isConvertible(const Pimpl& other) const noexcept
 {
+    if (other.get() == this)
+        return true;
     return other->isConvertibleTo(*this);
 }
 
-bool UnrefLogUnit::isConvertibleTo(const CanonicalUnit& other) const
+bool UnrefLogUnit::isConvertibleTo(const CanonicalUnit& other) const noexcept
 {
     return false;
 }
 
-bool UnrefLogUnit::isConvertibleTo(const AffineUnit& other) const
+bool UnrefLogUnit::isConvertibleTo(const AffineUnit& other) const noexcept
 {
     return false;
 }
 
-bool UnrefLogUnit::isConvertibleTo(const RefLogUnit& other) const
+bool UnrefLogUnit::isConvertibleTo(const RefLogUnit& other) const noexcept
 {
     return false;
 }
 
-bool UnrefLogUnit::isConvertibleTo(const UnrefLogUnit& other) const
+bool UnrefLogUnit::isConvertibleTo(const UnrefLogUnit& other) const noexcept
 {
     return true;
 }
@@ -183,7 +167,7 @@ Converter UnrefLogUnit::getConverterFrom(const RefLogUnit& input) const
 
 Converter UnrefLogUnit::getConverterFrom(const UnrefLogUnit& input) const
 {
-    return Converter(new FromConverter(input.logBase, logBase));
+    return ConverterIr().linear(0, input.logBase/logBase).compile();
 }
 
 } // Namespace
@@ -23,20 +23,19 @@
 #pragma once
 
 #include "LogUnit.h"
+#include "AllocStats.h"
 #include "Dimensionality.h"
 
 namespace quantity {
 
 /// A logarithmic unit with a reference level.
 class UnrefLogUnit final : public LogUnit
+                         , public AllocCounted<AllocStats::Class::UNREF_LOG_UNIT>
 {
 private:
     Dimensionality dims;    ///< Dimensionality of the relevant physical quantity
 
 public:
-    class ToConverter;      ///< Converter of numeric values in this affine unit to an output unit.
-    class FromConverter;    ///< Converter of numeric values in an input unit to this affine unit.
-
     /**
      * Constructs from a reference level and a logarithmic base.
      * @param[in] base          Logarithmic base: Unit::LogBase::TWO, Unit::LogBase::E, or
@@ -124,7 +123,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertible(const Pimpl& other) const override;
+    bool isConvertible(const Pimpl& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with a derived unit.
@@ -132,7 +131,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const CanonicalUnit& other) const override;
+    bool isConvertibleTo(const CanonicalUnit& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with an affine unit.
@@ -140,7 +139,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const AffineUnit& other) const override;
+    bool isConvertibleTo(const AffineUnit& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with a referenced logarithmic unit.
@@ -148,7 +147,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const RefLogUnit& other) const override;
+    bool isConvertibleTo(const RefLogUnit& other) const noexcept override;
 
     /**
      * Indicates if numeric values in this unit are convertible with an unreferenced logarithmic
@@ -157,7 +156,7 @@ public:
      * @retval    true  They are convertible
      * @retval    false They are not convertible
      */
-    bool isConvertibleTo(const UnrefLogUnit& other) const override;
+    bool isConvertibleTo(const UnrefLogUnit& other) const noexcept override;
 
     /**
      * Returns a converter of numeric values in this unit to an output unit.
@@ -74,6 +74,16 @@ TEST_F(AffineUnitTest, Construction)
     EXPECT_FALSE(unit1->isDimensionless());
 }
 
+/// Tests interning of equal units
+TEST_F(AffineUnitTest, Interning)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    EXPECT_EQ(celsius, Unit::get(kelvin, 1, -273.15));
+    EXPECT_NE(celsius, Unit::get(kelvin, 1, 273.15));
+    EXPECT_EQ(Unit::get(meter, 1000, 0)->multiply(second),
+              Unit::get(meter->multiply(second), 1000, 0));
+}
+
 /// Tests Unit::isConvertible()
 TEST_F(AffineUnitTest, IsConvertible)
 {
@@ -0,0 +1,130 @@
+/**
+ * This file tests class AllocStats.
+ *
+ *        File: AllocStats_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AllocStats.h"
+#include "BaseInfo.h"
+#include "CanonicalUnit.h"
+#include "Dimensionality.h"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `AllocStats`
+class AllocStatsTest : public ::testing::Test
+{
+protected:
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    AllocStatsTest()
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~AllocStatsTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+        AllocStats::reset();
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    Dimensionality length{Dimensionality::get("Length", "L")};
+    Unit::Pimpl    meter{Unit::get(BaseInfo(length, "meter", "m"))};
+};
+
+// Tests class names
+TEST_F(AllocStatsTest, Names)
+{
+    EXPECT_STREQ("CanonicalUnit", AllocStats::to_string(AllocStats::Class::CANONICAL_UNIT));
+    EXPECT_STREQ("ConverterImpl", AllocStats::to_string(AllocStats::Class::CONVERTER));
+}
+
+// Tests counting
+TEST_F(AllocStatsTest, Counting)
+{
+    {
+        const auto converter = meter->getConverterTo(meter);
+        const auto area = meter->pow(2);
+    }
+    const auto units = AllocStats::get(AllocStats::Class::CANONICAL_UNIT);
+    const auto converters = AllocStats::get(AllocStats::Class::CONVERTER);
+    const auto total = AllocStats::getTotal();
+
+    if (AllocStats::isEnabled()) {
+        EXPECT_EQ(1, units.allocs);
+        EXPECT_EQ(1, units.frees);
+        EXPECT_EQ(sizeof(CanonicalUnit), units.bytes);
+        EXPECT_EQ(1, converters.allocs);
+        EXPECT_EQ(1, converters.frees);
+        EXPECT_LE(2, total.allocs);
+    }
+    else {
+        EXPECT_EQ(0, units.allocs);
+        EXPECT_EQ(0, converters.allocs);
+        EXPECT_EQ(0, total.allocs);
+        EXPECT_EQ(0, total.bytes);
+        EXPECT_EQ(0, total.frees);
+    }
+
+    AllocStats::reset();
+    EXPECT_EQ(0, AllocStats::getTotal().allocs);
+}
+
+// Tests that counts are per thread
+TEST_F(AllocStatsTest, PerThread)
+{
+    uint64_t threadAllocs = 0;
+    std::thread thread([&] {
+        meter->pow(3);
+        threadAllocs = AllocStats::get(AllocStats::Class::CANONICAL_UNIT).allocs;
+    });
+    thread.join();
+
+    EXPECT_EQ(AllocStats::isEnabled() ? 1 : 0, threadAllocs);
+    EXPECT_EQ(0, AllocStats::get(AllocStats::Class::CANONICAL_UNIT).allocs);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,173 @@
+/**
+ * This file tests class Arena.
+ *
+ *        File: Arena_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Arena.h"
+#include "BaseInfo.h"
+#include "Dimensionality.h"
+#include "Unit.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `Arena`
+class ArenaTest : public ::testing::Test
+{
+protected:
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    ArenaTest()
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~ArenaTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    Dimensionality length{Dimensionality::get("Length", "L")};
+    Dimensionality time{Dimensionality::get("Time", "T")};
+    Unit::Pimpl    meter{Unit::get(BaseInfo(length, "meter", "m"))};
+    Unit::Pimpl    second{Unit::get(BaseInfo(time, "second", "s"))};
+};
+
+// Tests allocation without a scope
+TEST_F(ArenaTest, NoScope)
+{
+    auto ptr = Arena::allocate(10);
+    ASSERT_NE(nullptr, ptr);
+    Arena::deallocate(ptr);
+    Arena::deallocate(nullptr);
+}
+
+// Tests that allocations in a scope are contiguous
+TEST_F(ArenaTest, Contiguous)
+{
+    Arena::Scope scope;
+    auto first = static_cast<char*>(Arena::allocate(1));
+    auto second = static_cast<char*>(Arena::allocate(1));
+    EXPECT_EQ(2*alignof(std::max_align_t), second - first);
+
+    // Too large for the arena
+    auto large = static_cast<char*>(Arena::allocate(Arena::Scope::DEFAULT_BLOCK_SIZE));
+    auto third = static_cast<char*>(Arena::allocate(1));
+    EXPECT_EQ(2*alignof(std::max_align_t), third - second);
+
+    Arena::deallocate(first);
+    Arena::deallocate(second);
+    Arena::deallocate(third);
+    Arena::deallocate(large);
+}
+
+// Tests nested scopes
+TEST_F(ArenaTest, Nested)
+{
+    Arena::Scope outer;
+    auto first = static_cast<char*>(Arena::allocate(1));
+    char* inner;
+    {
+        Arena::Scope scope(1024);
+        inner = static_cast<char*>(Arena::allocate(1));
+    }
+    auto second = static_cast<char*>(Arena::allocate(1));
+    EXPECT_EQ(2*alignof(std::max_align_t), second - first);
+    Arena::deallocate(inner); // Releases the inner scope's block
+    Arena::deallocate(first);
+    Arena::deallocate(second);
+}
+
+// Tests that units outlive the scope that created them
+TEST_F(ArenaTest, Escape)
+{
+    Unit::Pimpl accel;
+    Dimensionality speed;
+    {
+        Arena::Scope scope;
+        accel = meter->divideBy(second->pow(2));
+        speed = length.divideBy(time);
+    }
+    EXPECT_EQ("m·s^-2", accel->to_string());
+    EXPECT_EQ(accel, meter->divideBy(second->pow(2)));
+    EXPECT_EQ("L·T^-1", speed.to_string());
+}
+
+// Tests that units created in a scope are interned in the scope and then in the enclosing table
+TEST_F(ArenaTest, ScopeInterning)
+{
+    Unit::Pimpl volume;
+    Unit::Pimpl perSecond;
+    {
+        Arena::Scope outer;
+        volume = meter->pow(3);
+        EXPECT_EQ(volume, meter->pow(2)->multiply(meter));
+        EXPECT_EQ(meter, volume->divideBy(meter->pow(2))); // Existing units are found
+        {
+            Arena::Scope inner;
+            EXPECT_EQ(volume, meter->pow(3)); // Found in the enclosing scope
+            perSecond = second->pow(-1);
+            EXPECT_EQ(perSecond, meter->divideBy(second)->divideBy(meter));
+        }
+        EXPECT_EQ(perSecond, second->pow(-1)); // Moved to the enclosing scope
+    }
+    EXPECT_EQ(volume, meter->pow(3)); // Moved to the process-wide table
+    EXPECT_EQ(perSecond, second->pow(-1));
+}
+
+// Tests destruction of arena objects on another thread
+TEST_F(ArenaTest, OtherThread)
+{
+    Unit::Pimpl area;
+    {
+        Arena::Scope scope;
+        area = meter->pow(2);
+    }
+    std::thread thread([&area] { area.reset(); });
+    thread.join();
+    EXPECT_FALSE(area);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -8,6 +8,8 @@
 #include "Unit.h"
 
 #include "gtest/gtest.h"
+#include <thread>
+#include <vector>
 
 namespace {
 
@@ -88,6 +90,43 @@ TEST_F(CanonicalUnitTest, Exponetiation)
 TEST_F(CanonicalUnitTest, Division)
 {
     EXPECT_EQ("m·s^-1", meter->divideBy(second)->to_string());
+
+    const auto one = meter->divideBy(meter);
+    EXPECT_TRUE(one->isDimensionless());
+    EXPECT_EQ("", one->to_string());
+    EXPECT_EQ("kg", kilogram->multiply(meter)->divideBy(meter)->to_string());
+    EXPECT_EQ(one, second->pow(Exponent(0)));
+}
+
+// Tests interning of equal units
+TEST_F(CanonicalUnitTest, Interning)
+{
+    EXPECT_EQ(meter, Unit::get(mInfo));
+    EXPECT_EQ(meter->multiply(second), second->multiply(meter));
+    EXPECT_EQ(meter->divideBy(second), meter->multiply(second->pow(Exponent(-1))));
+    EXPECT_EQ(meter, meter->pow(Exponent(2))->pow(Exponent(1, 2)));
+    EXPECT_NE(meter, second);
+    EXPECT_EQ(0, meter->compare(Unit::get(mInfo)));
+    EXPECT_TRUE(meter->isConvertible(Unit::get(mInfo)));
+}
+
+// Tests that threads that concurrently create equal units get the same instance
+TEST_F(CanonicalUnitTest, ConcurrentInterning)
+{
+    const int                             numThreads = 8;
+    std::vector<std::vector<Unit::Pimpl>> units(numThreads);
+    std::vector<std::thread>              threads;
+
+    for (int i = 0; i < numThreads; ++i)
+        threads.emplace_back([&, i] {
+            for (int j = -20; j <= 20; ++j)
+                units[i].push_back(meter->pow(Exponent(j))->divideBy(second));
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int i = 1; i < numThreads; ++i)
+        EXPECT_EQ(units[0], units[i]);
 }
 
 // Tests conversion
@@ -0,0 +1,290 @@
+/**
+ * This file tests class ConverterCache.
+ *
+ *        File: ConverterCache_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BaseInfo.h"
+#include "ConverterCache.h"
+#include "Dimensionality.h"
+#include "Unit.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `ConverterCache`
+class ConverterCacheTest : public ::testing::Test
+{
+protected:
+    Dimensionality length;
+    Dimensionality temperature;
+
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    ConverterCacheTest()
+        : length(Dimensionality::get("Length", "L"))
+        , temperature(Dimensionality::get("Temperature", "Θ"))
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~ConverterCacheTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    Unit::Pimpl meter{Unit::get(BaseInfo(length, "meter", "m"))};
+    Unit::Pimpl kelvin{Unit::get(BaseInfo(temperature, "kelvin", "°K"))};
+};
+
+// Tests construction
+TEST_F(ConverterCacheTest, Construction)
+{
+    EXPECT_THROW(ConverterCache(0), std::invalid_argument);
+    EXPECT_THROW(ConverterCache(1, 0), std::invalid_argument);
+
+    ConverterCache cache{};
+    const auto stats = cache.getStats();
+    EXPECT_EQ(0, stats.hits);
+    EXPECT_EQ(0, stats.misses);
+    EXPECT_EQ(0, stats.evictions);
+    EXPECT_EQ(0, stats.size);
+}
+
+// Tests hits and misses
+TEST_F(ConverterCacheTest, HitsAndMisses)
+{
+    ConverterCache cache{};
+    const auto     celsius = Unit::get(kelvin, 1, -273.15);
+
+    const auto converter = cache.get(celsius, kelvin);
+    EXPECT_DOUBLE_EQ(273.15, converter(0));
+    EXPECT_EQ(0, cache.getStats().hits);
+    EXPECT_EQ(1, cache.getStats().misses);
+
+    EXPECT_EQ(converter.pImpl, cache.get(celsius, kelvin).pImpl);
+    EXPECT_EQ(1, cache.getStats().hits);
+
+    // An equal but different unit object shares the entry
+    EXPECT_EQ(converter.pImpl, cache.get(Unit::get(kelvin, 1, -273.15), kelvin).pImpl);
+    EXPECT_EQ(2, cache.getStats().hits);
+
+    // The reverse direction is a different entry
+    EXPECT_NE(converter.pImpl, cache.get(kelvin, celsius).pImpl);
+    EXPECT_EQ(2, cache.getStats().misses);
+    EXPECT_EQ(2, cache.getStats().size);
+
+    cache.clear();
+    EXPECT_EQ(0, cache.getStats().hits);
+    EXPECT_EQ(0, cache.getStats().size);
+}
+
+// Tests that inconvertible units aren't cached
+TEST_F(ConverterCacheTest, Inconvertible)
+{
+    ConverterCache cache{};
+    EXPECT_THROW(cache.get(meter, kelvin), std::invalid_argument);
+    EXPECT_EQ(0, cache.getStats().size);
+}
+
+// Tests obtaining converters in both directions
+TEST_F(ConverterCacheTest, Bidirectional)
+{
+    ConverterCache cache{};
+    const auto     celsius = Unit::get(kelvin, 1, -273.15);
+
+    const auto converters = cache.getBidirectional(celsius, kelvin);
+    EXPECT_DOUBLE_EQ(273.15, converters.forward(0));
+    EXPECT_DOUBLE_EQ(0, converters.backward(273.15));
+    EXPECT_EQ(2, cache.getStats().misses);
+    EXPECT_EQ(1, cache.getStats().size);
+
+    // Only the forward converter is cached
+    EXPECT_EQ(converters.forward.pImpl, cache.get(celsius, kelvin).pImpl);
+    EXPECT_EQ(1, cache.getStats().hits);
+
+    // So the reverse direction is the directly dispatched converter regardless of the order of
+    // the calls
+    ConverterCache other{};
+    const auto     direct = other.get(kelvin, celsius);
+    const auto     cached = cache.get(kelvin, celsius);
+    EXPECT_NE(converters.backward.pImpl, cached.pImpl);
+    for (const double value : {0.0, 1.0, 273.15, 1e3, -40.0})
+        EXPECT_EQ(direct(value), cached(value)) << value;
+
+    // A cached backward converter is reused
+    const auto reversed = cache.getBidirectional(kelvin, celsius);
+    EXPECT_EQ(cached.pImpl, reversed.forward.pImpl);
+    EXPECT_EQ(converters.forward.pImpl, reversed.backward.pImpl);
+
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    const auto logConverters = Unit::getBidirectionalConverter(meter, lgMeter);
+    EXPECT_NEAR(3, logConverters.forward(1000), 1e-12);
+    EXPECT_NEAR(1000, logConverters.backward(3), 1e-9);
+
+    EXPECT_THROW(cache.getBidirectional(meter, kelvin), std::invalid_argument);
+}
+
+// Tests eviction of the least-recently used entry
+TEST_F(ConverterCacheTest, Eviction)
+{
+    ConverterCache cache{2, 1};
+    const auto     celsius = Unit::get(kelvin, 1, -273.15);
+    const auto     rankine = Unit::get(kelvin, 1.8, 0);
+
+    cache.get(celsius, kelvin);
+    cache.get(rankine, kelvin);
+    cache.get(celsius, kelvin);     // Now most-recently used
+    cache.get(kelvin, celsius);     // Evicts (rankine, kelvin)
+    EXPECT_EQ(1, cache.getStats().evictions);
+    EXPECT_EQ(2, cache.getStats().size);
+
+    const auto hits = cache.getStats().hits;
+    cache.get(celsius, kelvin);
+    EXPECT_EQ(hits + 1, cache.getStats().hits);
+    cache.get(rankine, kelvin);
+    EXPECT_EQ(hits + 1, cache.getStats().hits);
+}
+
+// Tests that the cache doesn't extend the lifetime of units
+TEST_F(ConverterCacheTest, WeakKeys)
+{
+    ConverterCache cache{};
+    auto           celsius = Unit::get(kelvin, 1, -273.15);
+    cache.get(celsius, kelvin);
+    EXPECT_EQ(1, celsius.use_count());
+
+    celsius.reset();
+    celsius = Unit::get(kelvin, 1, -273.15);
+    cache.get(celsius, kelvin);     // Discards the stale entry
+    EXPECT_EQ(1, cache.getStats().evictions);
+    EXPECT_EQ(2, cache.getStats().misses);
+    EXPECT_EQ(1, cache.getStats().size);
+}
+
+// Tests concurrent access
+TEST_F(ConverterCacheTest, Concurrency)
+{
+    ConverterCache cache{8, 4};
+    std::vector<Unit::Pimpl> units;
+    for (int i = 1; i <= 16; ++i)
+        units.push_back(Unit::get(kelvin, i, 0));
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < 1000; ++j) {
+                const auto k = j % units.size();
+                EXPECT_DOUBLE_EQ(1, cache.get(units[k], kelvin)(k + 1));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    const auto stats = cache.getStats();
+    EXPECT_EQ(4000, stats.hits + stats.misses);
+    EXPECT_LE(stats.size, 8);
+}
+
+// Tests the process-wide cache
+TEST_F(ConverterCacheTest, Unit)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    const auto converter = Unit::getConverter(celsius, kelvin);
+    EXPECT_DOUBLE_EQ(273.15, converter(0));
+    EXPECT_EQ(converter.pImpl, Unit::getConverter(celsius, kelvin).pImpl);
+}
+
+// Tests obtaining a converter without exceptions
+TEST_F(ConverterCacheTest, TryGetConverter)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+
+    auto result = Unit::tryGetConverter(celsius, kelvin);
+    ASSERT_TRUE(static_cast<bool>(result));
+    EXPECT_EQ(Unit::ConverterError::NONE, result.error);
+    EXPECT_DOUBLE_EQ(273.15, result.converter(0));
+    EXPECT_EQ(Unit::getConverter(celsius, kelvin).pImpl, result.converter.pImpl);
+
+    result = Unit::tryGetConverter(meter, kelvin);
+    EXPECT_FALSE(static_cast<bool>(result));
+    EXPECT_EQ(Unit::ConverterError::INCONVERTIBLE, result.error);
+    EXPECT_EQ(nullptr, result.converter.pImpl);
+
+    EXPECT_EQ(Unit::ConverterError::NULL_UNIT, Unit::tryGetConverter(meter, nullptr).error);
+    EXPECT_EQ(Unit::ConverterError::NULL_UNIT, Unit::tryGetConverter(nullptr, meter).error);
+
+    // The result agrees with getConverter() for every kind of unit
+    const Unit::Pimpl units[] = {
+        meter,
+        kelvin,
+        Unit::get(meter, 3, 5),
+        celsius,
+        Unit::get(Unit::BaseEnum::TEN, meter),
+        Unit::get(Unit::BaseEnum::E, kelvin),
+        Unit::get(Unit::BaseEnum::TWO, length),
+        Unit::get(Unit::BaseEnum::TEN, temperature)
+    };
+    for (const auto& input : units) {
+        for (const auto& output : units) {
+            bool convertible = true;
+            try {
+                Unit::getConverter(input, output);
+            }
+            catch (const std::invalid_argument& ex) {
+                convertible = false;
+            }
+            const auto result = Unit::tryGetConverter(input, output);
+            EXPECT_EQ(convertible, static_cast<bool>(result))
+                    << input->to_string() << " -> " << output->to_string();
+            EXPECT_EQ(convertible, input->isConvertible(output))
+                    << input->to_string() << " -> " << output->to_string();
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,185 @@
+/**
+ * This file tests class ConverterIr.
+ *
+ *        File: ConverterIr_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BaseInfo.h"
+#include "Converter.h"
+#include "ConverterIr.h"
+#include "Dimensionality.h"
+#include "LinearConverter.h"
+#include "Unit.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `ConverterIr`
+class ConverterIrTest : public ::testing::Test
+{
+protected:
+    Dimensionality length;
+    Dimensionality temperature;
+
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    ConverterIrTest()
+        : length(Dimensionality::get("Length", "L"))
+        , temperature(Dimensionality::get("Temperature", "Θ"))
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~ConverterIrTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    /**
+     * Returns the operation codes of a converter.
+     * @param[in] converter The converter
+     * @return              The operation codes of the converter in the order in which they're
+     *                      applied
+     */
+    static std::vector<ConverterIr::OpCode> opCodes(const Converter& converter)
+    {
+        const auto                       ir = ConverterIr::lower(converter);
+        std::vector<ConverterIr::OpCode> opCodes;
+        for (const auto& op : ir.getOps())
+            opCodes.push_back(op.opCode);
+        return opCodes;
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    Unit::Pimpl meter{Unit::get(BaseInfo(length, "meter", "m"))};
+    Unit::Pimpl kelvin{Unit::get(BaseInfo(temperature, "kelvin", "°K"))};
+    const ConverterIr::OpCode LINEAR = ConverterIr::OpCode::LINEAR;
+    const ConverterIr::OpCode LOG = ConverterIr::OpCode::LOG;
+    const ConverterIr::OpCode EXP = ConverterIr::OpCode::EXP;
+};
+
+// Tests the simplification of operations
+TEST_F(ConverterIrTest, Simplify)
+{
+    EXPECT_TRUE(ConverterIr().linear(0, 1).simplify().getOps().empty());
+    EXPECT_TRUE(ConverterIr().linear(0, 2).linear(0, 0.5).simplify().getOps().empty());
+    EXPECT_TRUE(ConverterIr().exp(std::log(10)).log(1/std::log(10)).simplify().getOps().empty());
+
+    const auto ops = ConverterIr().exp(2).linear(0, 3).log(0.5).simplify().getOps();
+    ASSERT_EQ(1, ops.size());
+    EXPECT_EQ(LINEAR, ops[0].opCode);
+    EXPECT_DOUBLE_EQ(1, ops[0].scale);
+    EXPECT_DOUBLE_EQ(0.5*std::log(3), ops[0].intercept);
+
+    // The logarithm of a negative number isn't defined, so this mustn't be simplified
+    EXPECT_EQ(3, ConverterIr().exp(2).linear(0, -3).log(0.5).simplify().getOps().size());
+
+    // A logarithm followed by an exponential isn't defined for non-positive input
+    EXPECT_EQ(2, ConverterIr().log(0.5).exp(2).simplify().getOps().size());
+}
+
+// Tests that nested affine conversions become a single linear operation
+TEST_F(ConverterIrTest, Affine)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    const auto fahrenheit = Unit::get(celsius, 1.8, 32);
+
+    const auto fToK = fahrenheit->getConverterTo(kelvin);
+    EXPECT_NE(nullptr, LinearConverter::cast(fToK));
+    EXPECT_NEAR(273.15, fToK(32), 1e-12);
+}
+
+// Tests that a change of reference level of a logarithmic unit becomes a single linear operation
+TEST_F(ConverterIrTest, RefLogLevel)
+{
+    const auto kilometer = Unit::get(meter, 0.001, 0);
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    const auto lgKilometer = Unit::get(Unit::BaseEnum::TEN, kilometer);
+
+    const auto converter = lgMeter->getConverterTo(lgKilometer);
+    const auto linear = LinearConverter::cast(converter);
+    ASSERT_NE(nullptr, linear);
+    EXPECT_EQ(1, linear->getScale());
+    EXPECT_NEAR(0, converter(3), 1e-12);
+    EXPECT_NEAR(2, converter(5), 1e-12);
+}
+
+// Tests that a change of base of a logarithmic unit becomes a single linear operation
+TEST_F(ConverterIrTest, LogBase)
+{
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    const auto lnMeter = Unit::get(Unit::BaseEnum::E, meter);
+    const auto toLn = lgMeter->getConverterTo(lnMeter);
+    ASSERT_NE(nullptr, LinearConverter::cast(toLn));
+    EXPECT_NEAR(std::log(100), toLn(2), 1e-12);
+
+    const auto lgLength = Unit::get(Unit::BaseEnum::TEN, length);
+    const auto lbLength = Unit::get(Unit::BaseEnum::TWO, length);
+    const auto toLb = lgLength->getConverterTo(lbLength);
+    ASSERT_NE(nullptr, LinearConverter::cast(toLb));
+    EXPECT_NEAR(std::log2(100), toLb(2), 1e-12);
+}
+
+// Tests that a conversion out of a logarithmic unit is a flat sequence of operations
+TEST_F(ConverterIrTest, Flat)
+{
+    const auto millimeter = Unit::get(meter, 1000, 0);
+    const auto lgMillimeter = Unit::get(Unit::BaseEnum::TEN, millimeter);
+
+    const auto toMeter = lgMillimeter->getConverterTo(meter);
+    EXPECT_EQ((std::vector<ConverterIr::OpCode>{EXP, LINEAR}), opCodes(toMeter));
+    EXPECT_NEAR(1, toMeter(3), 1e-12);
+
+    const auto fromMeter = meter->getConverterTo(lgMillimeter);
+    EXPECT_EQ((std::vector<ConverterIr::OpCode>{LINEAR, LOG}), opCodes(fromMeter));
+    EXPECT_NEAR(3, fromMeter(1), 1e-12);
+
+    double values[] = {1, 2, 3};
+    toMeter.convert(values, 3);
+    EXPECT_NEAR(0.01, values[0], 1e-15);
+    EXPECT_NEAR(0.1, values[1], 1e-15);
+    EXPECT_NEAR(1, values[2], 1e-15);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,354 @@
+/**
+ * This file tests class Converter.
+ *
+ *        File: Converter_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BaseInfo.h"
+#include "Converter.h"
+#include "Dimensionality.h"
+#include "LinearConverter.h"
+#include "ThreadPool.h"
+#include "Unit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `Converter`
+class ConverterTest : public ::testing::Test
+{
+protected:
+    Dimensionality length;
+    Dimensionality temperature;
+
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    ConverterTest()
+        : length(Dimensionality::get("Length", "L"))
+        , temperature(Dimensionality::get("Temperature", "Θ"))
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~ConverterTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    /**
+     * Verifies that array conversion agrees with scalar conversion.
+     * @param[in] converter The converter to verify
+     * @param[in] values    The input values
+     */
+    static void expectSameAsScalar(const Converter& converter, const std::vector<double>& values)
+    {
+        std::vector<double> out(values.size());
+        converter.convert(values.data(), out.data(), values.size());
+        for (size_t i = 0; i < values.size(); ++i)
+            EXPECT_DOUBLE_EQ(converter(values[i]), out[i]);
+
+        std::vector<double> inPlace(values);
+        converter.convert(inPlace.data(), inPlace.size());
+        for (size_t i = 0; i < values.size(); ++i)
+            EXPECT_DOUBLE_EQ(converter(values[i]), inPlace[i]);
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    Unit::Pimpl meter{Unit::get(BaseInfo(length, "meter", "m"))};
+    Unit::Pimpl kelvin{Unit::get(BaseInfo(temperature, "kelvin", "°K"))};
+    std::vector<double> values{0, 1, 2.5, 10, 273.15, 1000, 12345.678};
+};
+
+// Tests array conversion with a trivial converter
+TEST_F(ConverterTest, Trivial)
+{
+    expectSameAsScalar(meter->getConverterTo(meter), values);
+}
+
+// Tests array conversion with affine converters
+TEST_F(ConverterTest, Affine)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    const auto fahrenheit = Unit::get(celsius, 1.8, 32);
+    expectSameAsScalar(kelvin->getConverterTo(fahrenheit), values);
+    expectSameAsScalar(fahrenheit->getConverterTo(kelvin), values);
+    expectSameAsScalar(fahrenheit->getConverterTo(celsius), values);
+}
+
+// Tests folding of nested affine conversions into a single linear converter
+TEST_F(ConverterTest, Folding)
+{
+    const auto rankine = Unit::get(kelvin, 1.8, 0);
+    const auto fahrenheit = Unit::get(rankine, 1, -459.67);
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+
+    EXPECT_NE(nullptr, LinearConverter::cast(meter->getConverterTo(meter)));
+    EXPECT_NE(nullptr, LinearConverter::cast(fahrenheit->getConverterTo(celsius)));
+    EXPECT_NE(nullptr, LinearConverter::cast(celsius->getConverterTo(fahrenheit)));
+
+    const auto fToC = fahrenheit->getConverterTo(celsius);
+    EXPECT_NEAR(0, fToC(32), 1e-12);
+    EXPECT_NEAR(100, fToC(212), 1e-12);
+    EXPECT_NEAR(-40, fToC(-40), 1e-12);
+
+    const auto cToF = celsius->getConverterTo(fahrenheit);
+    EXPECT_NEAR(32, cToF(0), 1e-12);
+    EXPECT_NEAR(212, cToF(100), 1e-12);
+    expectSameAsScalar(cToF, values);
+
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    EXPECT_EQ(nullptr, LinearConverter::cast(lgMeter->getConverterTo(meter)));
+}
+
+// Tests array conversion with logarithmic converters
+TEST_F(ConverterTest, Logarithmic)
+{
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    const auto lbMeter = Unit::get(Unit::BaseEnum::TWO, meter);
+    expectSameAsScalar(lgMeter->getConverterTo(lbMeter), values);
+    expectSameAsScalar(meter->getConverterTo(lgMeter), {1, 2.5, 10, 1000});
+    expectSameAsScalar(lgMeter->getConverterTo(meter), values);
+
+    const auto lgLength = Unit::get(Unit::BaseEnum::TEN, length);
+    const auto lnLength = Unit::get(Unit::BaseEnum::E, length);
+    expectSameAsScalar(lgLength->getConverterTo(lnLength), values);
+}
+
+// Tests array conversion with fast logarithms and exponentials
+TEST_F(ConverterTest, Fast)
+{
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    const auto toMeter = lgMeter->getConverterTo(meter);
+    const auto fromMeter = meter->getConverterTo(lgMeter);
+    EXPECT_EQ(Converter::Accuracy::FULL, toMeter.getAccuracy());
+
+    const auto fastToMeter = toMeter.withAccuracy(Converter::Accuracy::FAST);
+    const auto fastFromMeter = fromMeter.withAccuracy(Converter::Accuracy::FAST);
+    EXPECT_EQ(Converter::Accuracy::FAST, fastToMeter.getAccuracy());
+    EXPECT_EQ(toMeter.pImpl, fastToMeter.pImpl);
+
+    const std::vector<double> levels{-300, -1, 0, 1, 2.5, 10, 273.15};
+    std::vector<double> out(levels.size());
+    fastToMeter.convert(levels.data(), out.data(), levels.size());
+    for (size_t i = 0; i < levels.size(); ++i)
+        EXPECT_NEAR(1, out[i]/toMeter(levels[i]), 1e-12);
+
+    const std::vector<double> lengths{1, 2.5, 10, 1000};
+    out.resize(lengths.size());
+    fastFromMeter.convert(lengths.data(), out.data(), lengths.size());
+    for (size_t i = 0; i < lengths.size(); ++i)
+        EXPECT_NEAR(fromMeter(lengths[i]), out[i], 1e-12);
+}
+
+// Tests the analytic inverse of converters
+TEST_F(ConverterTest, Inverse)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    const auto fahrenheit = Unit::get(celsius, 1.8, 32);
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    const auto lgMillimeter = Unit::get(Unit::BaseEnum::TEN, Unit::get(meter, 1000, 0));
+    const auto lbLength = Unit::get(Unit::BaseEnum::TWO, length);
+    const auto lnLength = Unit::get(Unit::BaseEnum::E, length);
+    const Unit::Pimpl pairs[][2] = {
+        {meter, meter},
+        {fahrenheit, kelvin},
+        {kelvin, fahrenheit},
+        {lgMeter, meter},
+        {meter, lgMillimeter},
+        {lgMeter, lgMillimeter},
+        {lbLength, lnLength}
+    };
+
+    for (const auto& pair : pairs) {
+        const auto forward = pair[0]->getConverterTo(pair[1]);
+        const auto inverse = forward.inverse();
+        const auto backward = pair[1]->getConverterTo(pair[0]);
+        for (const auto value : {0.5, 1.0, 2.5, 10.0}) {
+            const auto converted = backward(value);
+            EXPECT_NEAR(converted, inverse(value), 1e-12*std::abs(converted))
+                    << pair[1]->to_string() << " -> " << pair[0]->to_string();
+            EXPECT_NEAR(value, inverse(forward(value)), 1e-12*value);
+        }
+        expectSameAsScalar(inverse, {0.5, 1, 2.5, 10});
+    }
+
+    // The inverse of a linear converter is linear and keeps the accuracy
+    const auto fastToMeter = lgMeter->getConverterTo(meter).withAccuracy(Converter::Accuracy::FAST);
+    EXPECT_EQ(Converter::Accuracy::FAST, fastToMeter.inverse().getAccuracy());
+    EXPECT_NE(nullptr, LinearConverter::cast(fahrenheit->getConverterTo(kelvin).inverse()));
+}
+
+// Tests conversion of an empty array
+TEST_F(ConverterTest, Empty)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    const auto converter = celsius->getConverterTo(kelvin);
+    converter.convert(static_cast<const double*>(nullptr), static_cast<double*>(nullptr), 0);
+    converter.convert(static_cast<const float*>(nullptr), static_cast<float*>(nullptr), 0);
+    converter.convert(static_cast<const float*>(nullptr), static_cast<double*>(nullptr), 0);
+}
+
+// Tests conversion of evenly-spaced values
+TEST_F(ConverterTest, Strided)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    const Converter converters[] = {
+        celsius->getConverterTo(kelvin),
+        lgMeter->getConverterTo(meter)
+    };
+    const size_t n = 300; // More than one chunk of the default implementation
+
+    for (const auto& converter : converters) {
+        std::vector<double> in(3*n);
+        for (size_t i = 0; i < in.size(); ++i)
+            in[i] = 0.01*i;
+        std::vector<double> out(2*n, -1);
+        converter.convert(in.data() + 1, 3*sizeof(double), out.data(), 2*sizeof(double), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_DOUBLE_EQ(converter(in[3*i + 1]), out[2*i]) << i;
+            EXPECT_EQ(-1, out[2*i + 1]) << i;
+        }
+
+        std::vector<double> inPlace(in);
+        converter.convert(inPlace.data(), 3*sizeof(double), inPlace.data(), 3*sizeof(double), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_DOUBLE_EQ(converter(in[3*i]), inPlace[3*i]) << i;
+            EXPECT_EQ(in[3*i + 1], inPlace[3*i + 1]) << i;
+        }
+
+        // Unit strides are a contiguous conversion
+        std::vector<double> contiguous(n);
+        converter.convert(in.data(), sizeof(double), contiguous.data(), sizeof(double), n);
+        for (size_t i = 0; i < n; ++i)
+            EXPECT_DOUBLE_EQ(converter(in[i]), contiguous[i]) << i;
+    }
+}
+
+// Tests parallel conversion of arrays
+TEST_F(ConverterTest, Parallel)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    const Converter converters[] = {
+        celsius->getConverterTo(kelvin),
+        lgMeter->getConverterTo(meter).withAccuracy(Converter::Accuracy::FAST)
+    };
+    ThreadPool pool(3);
+    ThreadPool serialPool(0);
+
+    for (const auto& converter : converters) {
+        // Below the serial threshold, above it, and not a multiple of a page or chunk
+        for (const size_t n : {0, 1000, 1000003}) {
+            std::vector<double> in(n);
+            for (size_t i = 0; i < n; ++i)
+                in[i] = 1e-5*i;
+            std::vector<double> expect(n);
+            converter.convert(in.data(), expect.data(), n);
+
+            std::vector<double> out(n + 1, -1); // Misaligned output
+            converter.parallelConvert(in.data(), out.data() + 1, n, pool);
+            EXPECT_EQ(-1, out[0]);
+            for (size_t i = 0; i < n; ++i)
+                ASSERT_EQ(expect[i], out[i + 1]) << i;
+
+            auto inPlace = in;
+            converter.parallelConvert(inPlace.data(), inPlace.data(), n, serialPool);
+            EXPECT_EQ(expect, inPlace);
+
+            std::vector<double> global(n);
+            converter.parallelConvert(in.data(), global.data(), n);
+            EXPECT_EQ(expect, global);
+        }
+    }
+}
+
+// Tests conversion of single-precision arrays
+TEST_F(ConverterTest, Float)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    const auto fahrenheit = Unit::get(celsius, 1.8, 32);
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    const Converter converters[] = {
+        meter->getConverterTo(meter),
+        celsius->getConverterTo(kelvin),
+        fahrenheit->getConverterTo(celsius),
+        lgMeter->getConverterTo(meter),
+        meter->getConverterTo(lgMeter)
+    };
+    const std::vector<float> in{0.5f, 1, 2.5f, 3, 7, 10, 11, 13, 17, 19, 23, 29, 31, 0.001f, 0.25f,
+            1.5f, 4.75f};
+    const auto n = in.size();
+
+    for (const auto& converter : converters) {
+        std::vector<double> expect(n);
+        for (size_t i = 0; i < n; ++i)
+            expect[i] = converter(in[i]);
+
+        std::vector<double> wide(n);
+        converter.convert(in.data(), wide.data(), n);
+        for (size_t i = 0; i < n; ++i)
+            EXPECT_NEAR(expect[i], wide[i], 1e-13*std::abs(expect[i])) << i;
+
+        // Double-precision arithmetic is correctly rounded to single precision
+        std::vector<float> mixed(in);
+        converter.withFloatPrecision(Converter::FloatPrecision::DOUBLE).convert(mixed.data(), n);
+        for (size_t i = 0; i < n; ++i)
+            EXPECT_FLOAT_EQ(static_cast<float>(expect[i]), mixed[i]) << i;
+
+        // Single-precision arithmetic has the error of single-precision coefficients
+        std::vector<float> single(n);
+        converter.convert(in.data(), single.data(), n);
+        for (size_t i = 0; i < n; ++i)
+            EXPECT_NEAR(expect[i], single[i], 1e-6*std::max(std::abs(expect[i]), 300.0)) << i;
+    }
+
+    const auto converter = celsius->getConverterTo(kelvin);
+    EXPECT_EQ(Converter::FloatPrecision::SINGLE, converter.getFloatPrecision());
+    EXPECT_EQ(Converter::FloatPrecision::DOUBLE,
+            converter.withFloatPrecision(Converter::FloatPrecision::DOUBLE).getFloatPrecision());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
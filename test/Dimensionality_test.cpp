@@ -6,6 +6,8 @@
 #include "Exponent.h"
 
 #include "gtest/gtest.h"
+#include <stdexcept>
+#include <string>
 
 namespace {
 
@@ -92,6 +94,39 @@ TEST_F(DimensionalityTest, Division)
     EXPECT_EQ("L·T^-1", length.divideBy(time).to_string());
 }
 
+// Tests comparison and hashing
+TEST_F(DimensionalityTest, Comparison)
+{
+    auto length = Dimensionality::get("Length", "L");
+    auto mass = Dimensionality::get("Mass", "M");
+    auto time = Dimensionality::get("Time", "T");
+
+    const auto velocity = length.divideBy(time);
+    const auto velocity2 = time.pow(-1).multiply(length);
+    EXPECT_EQ(0, velocity.compare(velocity2));
+    EXPECT_EQ(velocity.hash(), velocity2.hash());
+    EXPECT_NE(0, velocity.compare(length));
+
+    EXPECT_EQ(0, length.divideBy(length).compare(Dimensionality()));
+    EXPECT_EQ(0, length.divideBy(length).size());
+    EXPECT_EQ(Dimensionality().hash(), mass.pow(0).hash());
+
+    EXPECT_LT(length.compare(mass), 0);     // Ordered by name
+    EXPECT_GT(mass.compare(length), 0);
+    EXPECT_LT(length.compare(length.pow(2)), 0);
+    EXPECT_LT(length.compare(length.multiply(mass)), 0);
+    EXPECT_EQ("L·M·T^-2", time.pow(-2).multiply(mass).multiply(length).to_string());
+}
+
+// Tests the limit on the number of base dimensions. Must be the last test because it exhausts them.
+TEST_F(DimensionalityTest, TooMany)
+{
+    EXPECT_THROW(
+        for (int i = 0; i < 17; ++i)
+            Dimensionality::get("Dimension" + std::to_string(i), "D" + std::to_string(i)),
+        std::length_error);
+}
+
 }  // namespace
 
 int main(int argc, char **argv) {
@@ -5,6 +5,8 @@
 #include "Exponent.h"
 
 #include "gtest/gtest.h"
+#include <stdexcept>
+#include <type_traits>
 
 namespace {
 
@@ -97,6 +99,32 @@ TEST_F(ExponentTest, Addition)
     EXPECT_EQ("1", Exponent().add(Exponent(0, -3)).to_string());
 }
 
+// Tests compile-time evaluation
+TEST_F(ExponentTest, Constexpr)
+{
+    static_assert(std::is_trivially_copyable<Exponent>::value, "Exponent isn't trivially copyable");
+    constexpr Exponent twoThirds(4, 6);
+    static_assert(twoThirds.getNumer() == 2 && twoThirds.getDenom() == 3, "Not in lowest terms");
+    static_assert(twoThirds.add(Exponent(1, 3)).isOne(), "Addition isn't constexpr");
+    static_assert(twoThirds.multiply(Exponent(3, 2)).isOne(), "Multiplication isn't constexpr");
+    static_assert(Exponent(0, -5).isZero(), "Zero isn't zero");
+    EXPECT_EQ("(2/3)", twoThirds.to_string());
+}
+
+// Tests overflow detection
+TEST_F(ExponentTest, Overflow)
+{
+    EXPECT_EQ(32767, Exponent(32767).getNumer());
+    EXPECT_EQ(-32768, Exponent(-32768).getNumer());
+    EXPECT_THROW(Exponent(32768), std::overflow_error);
+    EXPECT_THROW(Exponent(1, 40000), std::overflow_error);
+    EXPECT_EQ(1, Exponent(40000, 40000).getNumer()); // Reduced before the check
+
+    EXPECT_THROW(Exponent(300).multiply(Exponent(300)), std::overflow_error);
+    EXPECT_THROW(Exponent(1, 300).add(Exponent(1, 301)), std::overflow_error);
+    EXPECT_EQ("(1/150)", Exponent(1, 300).add(Exponent(1, 300)).to_string());
+}
+
 }  // namespace
 
 int main(int argc, char **argv) {
@@ -0,0 +1,185 @@
+/**
+ * This file tests class QvalueArray
+ *
+ *        File: QvalueArray_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BaseInfo.h"
+#include "Dimensionality.h"
+#include "QvalueArray.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `QvalueArray`
+class QvalueArrayTest : public ::testing::Test
+{
+protected:
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    QvalueArrayTest()
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~QvalueArrayTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    Dimensionality length{Dimensionality::get("Length", "L")};
+    Dimensionality time{Dimensionality::get("Time", "T")};
+    BaseInfo       meterInfo{length, "meter", "m"};
+    BaseInfo       secondInfo{time, "second", "s"};
+    Unit::Pimpl    meter{Unit::get(meterInfo)};
+    Unit::Pimpl    second{Unit::get(secondInfo)};
+    Unit::Pimpl    millimeter{Unit::get(meter, 1000, 0)};
+};
+
+// Tests construction and access
+TEST_F(QvalueArrayTest, Construction)
+{
+    QvalueArray zeros{meter, 3};
+    EXPECT_EQ(3, zeros.size());
+    EXPECT_EQ(meter, zeros.getUnit());
+    EXPECT_EQ(0, zeros[2]);
+
+    const double values[] = {1, 2, 3};
+    QvalueArray  copy{meter, values, 3};
+    EXPECT_NE(values, copy.data());
+    EXPECT_EQ(2, copy[1]);
+    EXPECT_EQ(Qvalue(3, meter), copy.at(2));
+    EXPECT_THROW(copy.at(3), std::out_of_range);
+
+    std::vector<double> vec{4, 5};
+    const auto          data = vec.data();
+    QvalueArray         adopted{meter, std::move(vec)};
+    EXPECT_EQ(data, adopted.data());
+    EXPECT_EQ(data, adopted.begin());
+    EXPECT_EQ(data + 2, adopted.end());
+
+    adopted.push_back(6);
+    adopted.push_back(Qvalue(7000, millimeter));
+    EXPECT_EQ(4, adopted.size());
+    EXPECT_DOUBLE_EQ(7, adopted[3]);
+    EXPECT_THROW(adopted.push_back(Qvalue(1, second)), std::invalid_argument);
+
+    const auto released = adopted.release();
+    EXPECT_EQ(4, released.size());
+    EXPECT_TRUE(adopted.empty());
+
+    EXPECT_THROW(QvalueArray(Unit::Pimpl()), std::invalid_argument);
+}
+
+// Tests conversion in place
+TEST_F(QvalueArrayTest, ConvertTo)
+{
+    std::vector<double> vec(1000);
+    for (size_t i = 0; i < vec.size(); ++i)
+        vec[i] = i;
+    QvalueArray array{meter, std::move(vec)};
+    const auto  data = array.data();
+
+    array.convertTo(millimeter);
+    EXPECT_EQ(millimeter, array.getUnit());
+    EXPECT_EQ(data, array.data());
+    for (size_t i = 0; i < array.size(); ++i)
+        EXPECT_DOUBLE_EQ(1000.0*i, array[i]);
+
+    EXPECT_THROW(array.convertTo(second), std::invalid_argument);
+}
+
+// Tests element-wise arithmetic
+TEST_F(QvalueArrayTest, Arithmetic)
+{
+    const size_t n = 1000; // More than one chunk
+    QvalueArray  meters{meter, n, 1};
+    QvalueArray  millimeters{millimeter, n, 500};
+
+    const QvalueArray sum = meters + millimeters;
+    EXPECT_EQ(meter, sum.getUnit());
+    for (const auto value : sum)
+        EXPECT_DOUBLE_EQ(1.5, value);
+
+    const QvalueArray difference = millimeters - meters;
+    EXPECT_EQ(millimeter, difference.getUnit());
+    EXPECT_DOUBLE_EQ(-500, difference[n-1]);
+
+    const QvalueArray seconds{second, n, 2};
+    QvalueArray       speed = meters/seconds;
+    EXPECT_EQ(meter->divideBy(second), speed.getUnit());
+    EXPECT_EQ(0.5, speed[0]);
+    speed *= seconds;
+    EXPECT_EQ(meter, speed.getUnit());
+    EXPECT_EQ(1, speed[0]);
+
+    speed *= 4.0;
+    speed /= 2.0;
+    EXPECT_EQ(2, speed[n-1]);
+
+    EXPECT_THROW(meters + seconds, std::invalid_argument);
+    EXPECT_THROW(meters + QvalueArray(meter, n + 1), std::invalid_argument);
+}
+
+// Tests reductions
+TEST_F(QvalueArrayTest, Reductions)
+{
+    const double      values[] = {3, -1, 4, 1, 5};
+    const QvalueArray array{meter, values, 5};
+
+    EXPECT_EQ(Qvalue(12, meter), array.sum());
+    EXPECT_EQ(Qvalue(2.4, meter), array.mean());
+    EXPECT_EQ(Qvalue(-1, meter), array.min());
+    EXPECT_EQ(Qvalue(5, meter), array.max());
+
+    const QvalueArray empty{meter};
+    EXPECT_EQ(0, empty.sum().getValue());
+    EXPECT_THROW(empty.mean(), std::out_of_range);
+    EXPECT_THROW(empty.min(), std::out_of_range);
+    EXPECT_THROW(empty.max(), std::out_of_range);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,165 @@
+/**
+ * This file tests QvalueArray expressions
+ *
+ *        File: QvalueExpr_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BaseInfo.h"
+#include "Dimensionality.h"
+#include "QvalueArray.h"
+#include "QvalueExpr.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing `QvalueArray` expressions
+class QvalueExprTest : public ::testing::Test
+{
+protected:
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    QvalueExprTest()
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~QvalueExprTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    Dimensionality length{Dimensionality::get("Length", "L")};
+    Dimensionality time{Dimensionality::get("Time", "T")};
+    BaseInfo       meterInfo{length, "meter", "m"};
+    BaseInfo       secondInfo{time, "second", "s"};
+    Unit::Pimpl    meter{Unit::get(meterInfo)};
+    Unit::Pimpl    second{Unit::get(secondInfo)};
+    Unit::Pimpl    millimeter{Unit::get(meter, 1000, 0)};
+    Unit::Pimpl    metersPerSecond{meter->divideBy(second)};
+    Unit::Pimpl    lgMeter{Unit::get(Unit::BaseEnum::TEN, meter)};
+};
+
+// Tests the displacement example: `x0 + v0*t`
+TEST_F(QvalueExprTest, Displacement)
+{
+    const size_t      n = 1000;
+    const QvalueArray x0{meter, n, 1};
+    const QvalueArray v0{metersPerSecond, n, 5};
+    const Qvalue      t{2, second};
+
+    const auto expr = x0 + v0*t; // Lazy: no values are computed
+    using Expr = std::decay<decltype(expr)>::type;
+    EXPECT_TRUE((std::is_base_of<QvalueExpr<Expr>, Expr>::value));
+    EXPECT_EQ(n, expr.size());
+    EXPECT_EQ(meter, expr.getUnit());
+
+    const QvalueArray x = x0 + v0*t;
+    EXPECT_EQ(meter, x.getUnit());
+    EXPECT_EQ(n, x.size());
+    for (const auto value : x)
+        EXPECT_EQ(11, value);
+
+    EXPECT_EQ(Qvalue(11*n, meter), sum(x0 + v0*t));
+}
+
+// Tests conversion of operands
+TEST_F(QvalueExprTest, Conversion)
+{
+    const QvalueArray meters{meter, 300, 1};
+    const QvalueArray millimeters{millimeter, 300, 250};
+
+    QvalueArray mm = millimeters + meters - Qvalue(0.5, meter);
+    EXPECT_EQ(millimeter, mm.getUnit());
+    EXPECT_DOUBLE_EQ(750, mm[299]);
+
+    const QvalueArray logs{lgMeter, 300, 2};
+    const QvalueArray m = meters + logs;
+    EXPECT_DOUBLE_EQ(101, m[0]);
+
+    EXPECT_THROW(meters + QvalueArray(second, 300), std::invalid_argument);
+    EXPECT_THROW(meters + QvalueArray(meter, 301), std::invalid_argument);
+}
+
+// Tests units of products and quotients
+TEST_F(QvalueExprTest, Units)
+{
+    const QvalueArray meters{meter, 4, 6};
+    const QvalueArray seconds{second, 4, 2};
+
+    const QvalueArray speed = meters/seconds;
+    EXPECT_EQ(metersPerSecond, speed.getUnit());
+    EXPECT_EQ(3, speed[0]);
+
+    const QvalueArray area = 0.5*meters*meters;
+    EXPECT_EQ(meter->pow(2), area.getUnit());
+    EXPECT_EQ(18, area[3]);
+
+    const QvalueArray frequency = Qvalue(1, meter)/(meters*seconds);
+    EXPECT_EQ(second->pow(-1), frequency.getUnit());
+    EXPECT_DOUBLE_EQ(1.0/12, frequency[1]);
+
+    const QvalueArray half = meters/2.0;
+    EXPECT_EQ(meter, half.getUnit());
+    EXPECT_EQ(3, half[2]);
+}
+
+// Tests assigning an expression that refers to its target
+TEST_F(QvalueExprTest, Aliasing)
+{
+    QvalueArray       x{meter, 10, 1};
+    const QvalueArray v{metersPerSecond, 10, 3};
+    const Qvalue      dt{0.5, second};
+
+    x = x + v*dt;
+    EXPECT_EQ(meter, x.getUnit());
+    EXPECT_EQ(2.5, x[9]);
+
+    x = x/dt;
+    EXPECT_EQ(metersPerSecond, x.getUnit());
+    EXPECT_EQ(5, x[0]);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -20,10 +20,16 @@
  * limitations under the License.
  */
 
+#include "BaseInfo.h"
+#include "Dimensionality.h"
 #include "Qvalue.h"
 
 #include <gtest/gtest.h>
-#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace {
 
@@ -33,9 +39,6 @@ using namespace quantity;
 class QvalueTest : public ::testing::Test
 {
 protected:
-    Quantity meter;
-    Quantity second;
-
     // You can remove any or all of the following functions if its body
     // is empty.
 
@@ -65,24 +68,130 @@ protected:
     }
 
     // Objects declared here can be used by all tests in the test case for Error.
+    Dimensionality length{Dimensionality::get("Length", "L")};
+    Dimensionality time{Dimensionality::get("Time", "T")};
+    Dimensionality temp{Dimensionality::get("Temperature", "Θ")};
+    BaseInfo       meterInfo{length, "meter", "m"};
+    BaseInfo       secondInfo{time, "second", "s"};
+    BaseInfo       kelvinInfo{temp, "kelvin", "K"};
+    Unit::Pimpl    meter{Unit::get(meterInfo)};
+    Unit::Pimpl    second{Unit::get(secondInfo)};
+    Unit::Pimpl    kelvin{Unit::get(kelvinInfo)};
+    Unit::Pimpl    celsius{Unit::get(kelvin, 1, -273.15)};
+    Unit::Pimpl    millimeter{Unit::get(meter, 1000, 0)};
+    Unit::Pimpl    metersPerSecond{meter->divideBy(second)};
 };
 
-// Speed example
+// Tests construction
 TEST_F(QvalueTest, Construction)
 {
-    Quantity meter{“Length”, “meter”, “m”};
-    EXPECT_THROW(Quantity(“Length”, “meter”, “m”), invalid_argument);
+    EXPECT_EQ(16, sizeof(Qvalue));
+
+    const Qvalue d{0.5, meter};
+    EXPECT_EQ(0.5, d.getValue());
+    EXPECT_EQ(meter, d.getUnit());
 
-    Quantity second(“Time”, “second”, “s”};
-    auto metersPerSecond = meter.divide(second);
+    Qvalue copy{d};
+    EXPECT_TRUE(copy.sameUnit(d));
+    EXPECT_TRUE(Qvalue(0.5, meter).sameUnit(d));
+    EXPECT_FALSE(Qvalue(0.5, second).sameUnit(d));
+
+    Qvalue moved{std::move(copy)};
+    EXPECT_EQ(0.5, moved.getValue());
+    copy = moved;
+    EXPECT_EQ(meter, copy.getUnit());
+    moved = Qvalue(2, second);
+    EXPECT_EQ(second, moved.getUnit());
+
+    EXPECT_THROW(Qvalue(1, Unit::Pimpl()), std::invalid_argument);
+}
 
-    Qvalue d{0.5, meter};
-    Qvalue t{1, second};
-    cout << “average speed = “ << d/t << ‘\n’;
+// Tests arithmetic in the same unit
+TEST_F(QvalueTest, SameUnit)
+{
+    const Qvalue x{1, meter};
+    const Qvalue y{0.5, meter};
+
+    EXPECT_EQ(Qvalue(1.5, meter), x + y);
+    EXPECT_EQ(Qvalue(0.5, meter), x - y);
+    EXPECT_EQ(Qvalue(2, meter), 2.0*x);
+    EXPECT_EQ(Qvalue(0.25, meter), y/2.0);
+    EXPECT_TRUE(y < x);
+    EXPECT_FALSE(x < y);
+
+    auto sum = x;
+    sum += y;
+    sum -= Qvalue(0.25, meter);
+    EXPECT_EQ(1.25, sum.getValue());
+}
+
+// Tests arithmetic in different units
+TEST_F(QvalueTest, DifferentUnits)
+{
+    const Qvalue x{1, meter};
+    const Qvalue y{500, millimeter};
+
+    const auto sum = x + y;
+    EXPECT_EQ(meter, sum.getUnit());
+    EXPECT_DOUBLE_EQ(1.5, sum.getValue());
+    EXPECT_DOUBLE_EQ(1500, (y + x).getValue());
+    EXPECT_TRUE(x == Qvalue(1000, millimeter));
+    EXPECT_TRUE(y < x);
+
+    EXPECT_DOUBLE_EQ(25, Qvalue(298.15, kelvin).convertTo(celsius).getValue());
+    EXPECT_THROW(x + Qvalue(1, second), std::invalid_argument);
+}
 
-    Qvalue v0{5, meterPerSecond};
-    Qvalue x0{1, meter};
-    cout << “total displacement = “ << x0 + v0*t << ‘\n’;
+// Speed example
+TEST_F(QvalueTest, Speed)
+{
+    const Qvalue d{0.5, meter};
+    const Qvalue t{1, second};
+
+    const auto speed = d/t;
+    EXPECT_EQ(metersPerSecond, speed.getUnit());
+    EXPECT_EQ(0.5, speed.getValue());
+
+    const Qvalue v0{5, metersPerSecond};
+    const Qvalue x0{1, meter};
+    const auto   x = x0 + v0*t;
+    EXPECT_EQ(meter, x.getUnit());
+    EXPECT_EQ(6, x.getValue());
+    EXPECT_EQ("6 m", x.to_string());
+}
+
+// Tests that a unit is released with the last instance that has it
+TEST_F(QvalueTest, Release)
+{
+    std::weak_ptr<const Unit> weak;
+    {
+        const auto furlong = Unit::get(meter, 1/201.168, 0);
+        weak = furlong;
+        const Qvalue x{1, furlong};
+        Qvalue       y{x + x};
+        y = 2.0*x;
+        y = y;
+    }
+    EXPECT_TRUE(weak.expired());
+}
+
+// Tests concurrent creation and destruction of instances in the same units
+TEST_F(QvalueTest, Concurrency)
+{
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; ++i)
+        threads.emplace_back([&] {
+            for (int j = 0; j < 1000; ++j) {
+                const auto unit = (j % 2) ? meter : Unit::get(meter, 1/201.168, 0);
+                Qvalue     x{1, unit};
+                const auto y = x + x;
+                x = Qvalue(y.getValue(), millimeter);
+                EXPECT_EQ(2, x.getValue());
+            }
+        });
+    for (auto& thread : threads)
+        thread.join();
 }
 
 }  // namespace
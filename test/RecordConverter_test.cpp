@@ -0,0 +1,212 @@
+/**
+ * This file tests class RecordConverter.
+ *
+ *        File: RecordConverter_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BaseInfo.h"
+#include "Dimensionality.h"
+#include "RecordConverter.h"
+#include "Unit.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using namespace quantity;
+
+/// A record of interleaved fields of different types, with padding
+struct Record
+{
+    float   lat;        ///< Latitude in degrees
+    float   lon;        ///< Longitude in degrees
+    int32_t station;    ///< Station identifier
+    double  temp;       ///< Temperature
+    char    flag;       ///< Quality flag
+    double  pressure;   ///< Pressure
+};
+
+#pragma pack(push, 1)
+/// A packed record, whose fields aren't aligned
+struct PackedRecord
+{
+    char   flag;        ///< Quality flag
+    double temp;        ///< Temperature
+};
+#pragma pack(pop)
+
+/// The fixture for testing class `RecordConverter`
+class RecordConverterTest : public ::testing::Test
+{
+protected:
+    Dimensionality length;
+    Dimensionality temperature;
+
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    RecordConverterTest()
+        : length(Dimensionality::get("Length", "L"))
+        , temperature(Dimensionality::get("Temperature", "Θ"))
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~RecordConverterTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    /**
+     * Returns records with distinct field values.
+     * @param[in] n The number of records
+     * @return      The records
+     */
+    static std::vector<Record> records(const size_t n)
+    {
+        std::vector<Record> records(n);
+        for (size_t i = 0; i < n; ++i)
+            records[i] = Record{0.001f*i, -0.002f*i, static_cast<int32_t>(i), 250 + 0.01*i,
+                    static_cast<char>(i), 1 + 0.5*i};
+        return records;
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    Unit::Pimpl meter{Unit::get(BaseInfo(length, "meter", "m"))};
+    Unit::Pimpl kelvin{Unit::get(BaseInfo(temperature, "kelvin", "°K"))};
+    const size_t recordSize = sizeof(Record);
+    const size_t tempOffset = offsetof(Record, temp);
+    const size_t pressureOffset = offsetof(Record, pressure);
+};
+
+// Tests construction and adding fields
+TEST_F(RecordConverterTest, Construction)
+{
+    EXPECT_THROW(RecordConverter(0), std::invalid_argument);
+    EXPECT_THROW(RecordConverter(sizeof(double) - 1), std::invalid_argument);
+
+    RecordConverter converter(recordSize);
+    EXPECT_EQ(sizeof(Record), converter.getRecordSize());
+    EXPECT_EQ(0, converter.getNumFields());
+    const auto identity = kelvin->getConverterTo(kelvin);
+    EXPECT_THROW(converter.add(recordSize, identity), std::out_of_range);
+    EXPECT_THROW(converter.add(recordSize - sizeof(double) + 1, identity), std::out_of_range);
+    converter.add(recordSize - sizeof(double), identity);
+
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    converter.add(tempOffset, kelvin->getConverterTo(celsius));
+    converter.add(tempOffset, celsius->getConverterTo(kelvin)); // Replaces
+    EXPECT_EQ(2, converter.getNumFields());
+
+    // Overlapping fields
+    EXPECT_THROW(converter.add(tempOffset + 1, identity), std::invalid_argument);
+    EXPECT_THROW(converter.add(tempOffset - 1, identity), std::invalid_argument);
+    EXPECT_THROW(converter.add(tempOffset + sizeof(double) - 1, identity), std::invalid_argument);
+    EXPECT_THROW(converter.add(recordSize - sizeof(double) - 4, identity), std::invalid_argument);
+    EXPECT_EQ(2, converter.getNumFields());
+}
+
+// Tests converting the fields of records
+TEST_F(RecordConverterTest, Convert)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    const auto toCelsius = kelvin->getConverterTo(celsius);
+    const auto toLg = meter->getConverterTo(lgMeter);
+
+    RecordConverter converter(recordSize);
+    converter.add(tempOffset, toCelsius).add(pressureOffset, toLg);
+
+    for (const size_t n : {0, 1, 7, 1000, 5000}) { // Less than and more than one block
+        const auto          in = records(n);
+        std::vector<Record> out(n);
+        converter.convert(in.data(), out.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(in[i].lat, out[i].lat) << i;
+            EXPECT_EQ(in[i].lon, out[i].lon) << i;
+            EXPECT_EQ(in[i].station, out[i].station) << i;
+            EXPECT_EQ(in[i].flag, out[i].flag) << i;
+            EXPECT_DOUBLE_EQ(toCelsius(in[i].temp), out[i].temp) << i;
+            EXPECT_DOUBLE_EQ(toLg(in[i].pressure), out[i].pressure) << i;
+        }
+
+        auto inPlace = in;
+        converter.convert(inPlace.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(in[i].lon, inPlace[i].lon) << i;
+            EXPECT_EQ(in[i].station, inPlace[i].station) << i;
+            EXPECT_EQ(out[i].temp, inPlace[i].temp) << i;
+            EXPECT_EQ(out[i].pressure, inPlace[i].pressure) << i;
+        }
+    }
+}
+
+// Tests converting unaligned fields of packed records
+TEST_F(RecordConverterTest, Packed)
+{
+    const auto celsius = Unit::get(kelvin, 1, -273.15);
+    const auto lgKelvin = Unit::get(Unit::BaseEnum::TEN, kelvin);
+    const Converter converters[] = {
+        kelvin->getConverterTo(celsius),    // Linear
+        kelvin->getConverterTo(lgKelvin)    // Not linear
+    };
+    const size_t n = 300; // More than one chunk of the default strided implementation
+
+    for (const auto& toOut : converters) {
+        std::vector<PackedRecord> in(n);
+        for (size_t i = 0; i < n; ++i)
+            in[i] = PackedRecord{static_cast<char>(i), 250 + 0.01*i};
+
+        RecordConverter converter(sizeof(PackedRecord));
+        converter.add(offsetof(PackedRecord, temp), toOut);
+        std::vector<PackedRecord> out(n);
+        converter.convert(in.data(), out.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(in[i].flag, out[i].flag) << i;
+            const double temp = in[i].temp;
+            const double outTemp = out[i].temp;
+            EXPECT_DOUBLE_EQ(toOut(temp), outTemp) << i;
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -80,6 +80,24 @@ TEST_F(RefLogUnitTest, Construction)
     const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
 }
 
+// Tests comparison
+TEST_F(RefLogUnitTest, Comparison)
+{
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    EXPECT_EQ(0, lgMeter->compare(Unit::get(Unit::BaseEnum::TEN, meter)));
+    EXPECT_NE(0, lgMeter->compare(Unit::get(Unit::BaseEnum::E, meter)));
+    EXPECT_NE(0, lgMeter->compare(Unit::get(Unit::BaseEnum::TEN, Unit::get(meter, 1000, 0))));
+}
+
+// Tests interning of equal units
+TEST_F(RefLogUnitTest, Interning)
+{
+    const auto lgMeter = Unit::get(Unit::BaseEnum::TEN, meter);
+    EXPECT_EQ(lgMeter, Unit::get(Unit::BaseEnum::TEN, meter));
+    EXPECT_NE(lgMeter, Unit::get(Unit::BaseEnum::E, meter));
+    EXPECT_NE(lgMeter, Unit::get(Unit::BaseEnum::TEN, Unit::get(meter, 1000, 0)));
+}
+
 // Tests string representation
 TEST_F(RefLogUnitTest, StringRepresentation)
 {
@@ -0,0 +1,277 @@
+/**
+ * This file tests class Simd.
+ *
+ *        File: Simd_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Simd.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `Simd`
+class SimdTest : public ::testing::Test
+{
+protected:
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    SimdTest()
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~SimdTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    /**
+     * Returns the error of a computed value in units of the last place of the correct value.
+     * @param[in] computed  The computed value
+     * @param[in] correct   The correctly-rounded value computed in extended precision
+     * @return              The error in ULP
+     */
+    static double ulps(const double computed, const long double correct)
+    {
+        const double rounded = static_cast<double>(correct);
+        if (computed == rounded)
+            return 0;
+        int exp;
+        std::frexp(rounded == 0 ? std::numeric_limits<double>::denorm_min() : rounded, &exp);
+        const long double ulp = std::max(std::ldexp(1.0L, exp - 53),
+                static_cast<long double>(std::numeric_limits<double>::denorm_min()));
+        return static_cast<double>(std::fabs(computed - correct)/ulp);
+    }
+
+    /**
+     * Returns values that sweep the exponent range of a double plus values near one.
+     * @return Positive, finite input values
+     */
+    static std::vector<double> positives()
+    {
+        std::vector<double> values;
+        for (int e = -1074; e <= 1023; e += 3)
+            for (const double m : {1.0, 1.1, 1.37, 1.5, 1.77, 1.999})
+                values.push_back(std::ldexp(m, e));
+        for (int i = -1000; i <= 1000; ++i)
+            values.push_back(1 + i*1e-5);
+        return values;
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    const Simd::Isa isas[4] = {Simd::Isa::SCALAR, Simd::Isa::SSE2, Simd::Isa::AVX2,
+            Simd::Isa::AVX512};
+};
+
+// Tests the detection of instruction-set architectures
+TEST_F(SimdTest, Detection)
+{
+    EXPECT_TRUE(Simd::isSupported(Simd::Isa::SCALAR));
+    EXPECT_TRUE(Simd::isSupported(Simd::best()));
+    EXPECT_STREQ("AVX2", Simd::to_string(Simd::Isa::AVX2));
+}
+
+// Tests the linear kernels against the scalar expression for every array length up to 40 so that
+// every tail path is exercised
+TEST_F(SimdTest, Linear)
+{
+    for (const auto isa : isas) {
+        if (!Simd::isSupported(isa)) {
+            EXPECT_THROW(Simd::linearKernel(isa), std::invalid_argument);
+            continue;
+        }
+        const auto kernel = Simd::linearKernel(isa);
+        for (size_t n = 0; n <= 40; ++n) {
+            std::vector<double> in(n);
+            for (size_t i = 0; i < n; ++i)
+                in[i] = 1.5*i - 7;
+            std::vector<double> out(n);
+            kernel(in.data(), out.data(), n, 32, 5.0/9.0, 273.15);
+            for (size_t i = 0; i < n; ++i)
+                EXPECT_DOUBLE_EQ(5.0/9.0*(in[i] - 32) + 273.15, out[i]) << Simd::to_string(isa);
+
+            kernel(in.data(), in.data(), n, 32, 5.0/9.0, 273.15); // In place
+            EXPECT_EQ(out, in) << Simd::to_string(isa);
+        }
+    }
+}
+
+// Tests that every linear kernel rounds each value as the scalar function does, whatever the value's
+// position in the array
+TEST_F(SimdTest, LinearRounding)
+{
+    // Values for which "scale*(x - offset) + intercept" and its fused form usually differ
+    std::vector<double> in(41);
+    for (size_t i = 0; i < in.size(); ++i)
+        in[i] = 0.1 + i/3.0;
+    const double offset = 0.3, scale = 1.0/7.0, intercept = -0.05;
+
+    std::vector<double> expected(in.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        expected[i] = Simd::linear(in[i], offset, scale, intercept);
+        if (Simd::isFused())
+            EXPECT_EQ(std::fma(scale, in[i] - offset, intercept), expected[i]);
+    }
+
+    for (const auto isa : isas) {
+        if (!Simd::isSupported(isa))
+            continue;
+        const auto kernel = Simd::linearKernel(isa);
+        for (size_t start = 0; start < 8; ++start) {
+            const size_t        n = in.size() - start;
+            std::vector<double> out(n);
+            kernel(in.data() + start, out.data(), n, offset, scale, intercept);
+            for (size_t i = 0; i < n; ++i)
+                EXPECT_EQ(expected[start + i], out[i]) << Simd::to_string(isa);
+        }
+    }
+}
+
+// Tests the single-precision, mixed-precision, and widening linear kernels against the scalar
+// expression for every array length up to 40 so that every tail path is exercised
+TEST_F(SimdTest, LinearFloat)
+{
+    for (const auto isa : isas) {
+        if (!Simd::isSupported(isa)) {
+            EXPECT_THROW(Simd::linearSingleKernel(isa), std::invalid_argument);
+            EXPECT_THROW(Simd::linearMixedKernel(isa), std::invalid_argument);
+            EXPECT_THROW(Simd::linearWideningKernel(isa), std::invalid_argument);
+            continue;
+        }
+        const auto single = Simd::linearSingleKernel(isa);
+        const auto mixed = Simd::linearMixedKernel(isa);
+        const auto widening = Simd::linearWideningKernel(isa);
+        for (size_t n = 0; n <= 40; ++n) {
+            std::vector<float> in(n);
+            for (size_t i = 0; i < n; ++i)
+                in[i] = 1.5f*i - 7;
+
+            std::vector<float> out(n);
+            single(in.data(), out.data(), n, 32, 5.0f/9.0f, 273.15f);
+            for (size_t i = 0; i < n; ++i)
+                EXPECT_FLOAT_EQ(5.0f/9.0f*(in[i] - 32) + 273.15f, out[i]) << Simd::to_string(isa);
+
+            mixed(in.data(), out.data(), n, 32, 5.0/9.0, 273.15);
+            for (size_t i = 0; i < n; ++i)
+                EXPECT_EQ(static_cast<float>(5.0/9.0*(in[i] - 32) + 273.15), out[i])
+                        << Simd::to_string(isa);
+
+            std::vector<double> wide(n);
+            widening(in.data(), wide.data(), n, 32, 5.0/9.0, 273.15);
+            for (size_t i = 0; i < n; ++i)
+                EXPECT_DOUBLE_EQ(5.0/9.0*(in[i] - 32) + 273.15, wide[i]) << Simd::to_string(isa);
+
+            std::vector<float> inPlace(in);
+            mixed(inPlace.data(), inPlace.data(), n, 32, 5.0/9.0, 273.15); // In place
+            EXPECT_EQ(out, inPlace) << Simd::to_string(isa);
+        }
+    }
+}
+
+// Tests the error of the exponential kernels
+TEST_F(SimdTest, Exp)
+{
+    std::vector<double> in;
+    for (double x = -745; x <= 709.7; x += 0.173)
+        in.push_back(x);
+    for (int i = -1000; i <= 1000; ++i)
+        in.push_back(i*1e-6);
+    for (const auto isa : isas) {
+        if (!Simd::isSupported(isa)) {
+            EXPECT_THROW(Simd::expKernel(isa), std::invalid_argument);
+            continue;
+        }
+        std::vector<double> out(in.size());
+        Simd::expKernel(isa)(in.data(), out.data(), in.size(), 1);
+        double maxUlps = 0;
+        for (size_t i = 0; i < in.size(); ++i)
+            maxUlps = std::max(maxUlps, ulps(out[i], std::exp(static_cast<long double>(in[i]))));
+        EXPECT_LE(maxUlps, 2) << Simd::to_string(isa);
+
+        const double inf = std::numeric_limits<double>::infinity();
+        const double specials[] = {-inf, inf, NAN, -800, 800, 0};
+        double results[6];
+        Simd::expKernel(isa)(specials, results, 6, 1);
+        EXPECT_EQ(0, results[0]) << Simd::to_string(isa);
+        EXPECT_EQ(inf, results[1]) << Simd::to_string(isa);
+        EXPECT_TRUE(std::isnan(results[2])) << Simd::to_string(isa);
+        EXPECT_EQ(0, results[3]) << Simd::to_string(isa);
+        EXPECT_EQ(inf, results[4]) << Simd::to_string(isa);
+        EXPECT_EQ(1, results[5]) << Simd::to_string(isa);
+    }
+}
+
+// Tests the error of the logarithm kernels
+TEST_F(SimdTest, Log)
+{
+    const auto in = positives();
+    for (const auto isa : isas) {
+        if (!Simd::isSupported(isa)) {
+            EXPECT_THROW(Simd::logKernel(isa), std::invalid_argument);
+            continue;
+        }
+        std::vector<double> out(in.size());
+        Simd::logKernel(isa)(in.data(), out.data(), in.size(), 1);
+        double maxUlps = 0;
+        for (size_t i = 0; i < in.size(); ++i)
+            maxUlps = std::max(maxUlps, ulps(out[i], std::log(static_cast<long double>(in[i]))));
+        EXPECT_LE(maxUlps, 2) << Simd::to_string(isa);
+
+        const double inf = std::numeric_limits<double>::infinity();
+        const double specials[] = {0, -1, inf, NAN, 1};
+        double results[5];
+        Simd::logKernel(isa)(specials, results, 5, 1);
+        EXPECT_EQ(-inf, results[0]) << Simd::to_string(isa);
+        EXPECT_TRUE(std::isnan(results[1])) << Simd::to_string(isa);
+        EXPECT_EQ(inf, results[2]) << Simd::to_string(isa);
+        EXPECT_TRUE(std::isnan(results[3])) << Simd::to_string(isa);
+        EXPECT_EQ(0, results[4]) << Simd::to_string(isa);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
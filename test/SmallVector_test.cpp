@@ -0,0 +1,166 @@
+/**
+ * This file tests class SmallVector.
+ *
+ *        File: SmallVector_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "SmallVector.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `SmallVector`
+class SmallVectorTest : public ::testing::Test
+{
+protected:
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    SmallVectorTest()
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~SmallVectorTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    using Strings = SmallVector<std::string, 2>;
+};
+
+// Tests growth beyond the inline storage
+TEST_F(SmallVectorTest, Growth)
+{
+    Strings strings;
+    EXPECT_TRUE(strings.empty());
+    for (int i = 0; i < 10; ++i) {
+        strings.push_back(std::to_string(i));
+        ASSERT_EQ(i + 1, strings.size());
+    }
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(std::to_string(i), strings[i]);
+
+    strings.clear();
+    EXPECT_TRUE(strings.empty());
+    EXPECT_EQ(strings.begin(), strings.end());
+}
+
+// Tests appending an element of the sequence to itself when the storage is full
+TEST_F(SmallVectorTest, SelfAppend)
+{
+    // Long enough that the strings are on the heap, so a use-after-free is detectable
+    const std::string first(100, 'a');
+    const std::string second(100, 'b');
+
+    for (const size_t size : {2, 4}) { // Full inline storage and full heap storage
+        Strings copy;
+        Strings move;
+        Strings emplace;
+        for (size_t i = 0; i < size; ++i) {
+            copy.push_back(i ? second : first);
+            move.push_back(i ? second : first);
+            emplace.push_back(i ? second : first);
+        }
+
+        copy.push_back(copy[0]);
+        EXPECT_EQ(first, copy[0]);
+        EXPECT_EQ(first, copy[size]);
+
+        move.push_back(std::move(move[0]));
+        EXPECT_EQ(first, move[size]);
+
+        emplace.emplace_back(emplace[0], 1);
+        EXPECT_EQ(first, emplace[0]);
+        EXPECT_EQ(first.substr(1), emplace[size]);
+
+        for (size_t i = 1; i < size; ++i) {
+            EXPECT_EQ(second, copy[i]);
+            EXPECT_EQ(second, move[i]);
+            EXPECT_EQ(second, emplace[i]);
+        }
+    }
+}
+
+// Tests copying and moving of inline and heap sequences
+TEST_F(SmallVectorTest, CopyAndMove)
+{
+    for (const size_t n : {1, 5}) {
+        Strings strings;
+        for (size_t i = 0; i < n; ++i)
+            strings.emplace_back(std::to_string(i));
+
+        Strings copy(strings);
+        EXPECT_EQ(n, copy.size());
+        EXPECT_EQ("0", copy[0]);
+
+        Strings moved(std::move(copy));
+        EXPECT_EQ(n, moved.size());
+        EXPECT_EQ(0, copy.size());
+
+        Strings assigned{"a", "b", "c"};
+        assigned = moved;
+        EXPECT_EQ(n, assigned.size());
+        assigned = std::move(moved);
+        EXPECT_EQ(n, assigned.size());
+        EXPECT_EQ(std::to_string(n - 1), assigned[n - 1]);
+        EXPECT_TRUE(moved.empty());
+    }
+}
+
+// Tests that elements are destroyed
+TEST_F(SmallVectorTest, Destruction)
+{
+    auto ptr = std::make_shared<int>(1);
+    {
+        SmallVector<std::shared_ptr<int>, 2> ptrs;
+        for (int i = 0; i < 5; ++i)
+            ptrs.push_back(ptr);
+        EXPECT_EQ(6, ptr.use_count());
+    }
+    EXPECT_EQ(1, ptr.use_count());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
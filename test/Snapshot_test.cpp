@@ -0,0 +1,228 @@
+/**
+ * This file tests class Snapshot.
+ *
+ *        File: Snapshot_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BaseInfo.h"
+#include "Dimensionality.h"
+#include "Snapshot.h"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `Snapshot`
+class SnapshotTest : public ::testing::Test
+{
+protected:
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    SnapshotTest()
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~SnapshotTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    using Map = std::map<int, std::string>;
+
+    /// A value that counts its instances
+    struct Counted
+    {
+        static std::atomic<int> live;   ///< Number of instances
+        int                     value;  ///< The value
+
+        Counted()
+            : value(0)
+        {
+            ++live;
+        }
+
+        Counted(const Counted& other)
+            : value(other.value)
+        {
+            ++live;
+        }
+
+        ~Counted()
+        {
+            --live;
+        }
+    };
+};
+
+std::atomic<int> SnapshotTest::Counted::live{0};
+
+// Tests reading and updating
+TEST_F(SnapshotTest, ReadAndUpdate)
+{
+    Snapshot<Map> snapshot;
+    EXPECT_TRUE(snapshot.read([](const Map& map) { return map.empty(); }));
+
+    snapshot.update([](Map& map) { map[1] = "one"; });
+    EXPECT_EQ(2, snapshot.update([](Map& map) {
+        map[2] = "two";
+        return map.size();
+    }));
+
+    EXPECT_EQ("two", snapshot.read([](const Map& map) { return map.at(2); }));
+}
+
+// Tests that a failed update leaves the value unchanged
+TEST_F(SnapshotTest, FailedUpdate)
+{
+    Snapshot<Map> snapshot;
+    snapshot.update([](Map& map) { map[1] = "one"; });
+
+    EXPECT_THROW(snapshot.update([](Map& map) {
+        map[2] = "two";
+        throw std::runtime_error("Failure");
+    }), std::runtime_error);
+
+    EXPECT_EQ(1, snapshot.read([](const Map& map) { return map.size(); }));
+}
+
+// Tests concurrent readers and writers
+TEST_F(SnapshotTest, Concurrency)
+{
+    Snapshot<Map>            snapshot;
+    std::atomic<bool>        done{false};
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 3; ++i) {
+        readers.emplace_back([&] {
+            while (!done) {
+                // Every snapshot is internally consistent: keys are 0 through size - 1
+                snapshot.read([](const Map& map) {
+                    int key = 0;
+                    for (const auto& entry : map)
+                        EXPECT_EQ(key++, entry.first);
+                });
+            }
+        });
+    }
+    for (int i = 0; i < 200; ++i)
+        snapshot.update([](Map& map) { map[map.size()] = "value"; });
+    done = true;
+    for (auto& thread : readers)
+        thread.join();
+
+    EXPECT_EQ(200, snapshot.read([](const Map& map) { return map.size(); }));
+}
+
+// Tests that replaced snapshots are reclaimed while readers never stop
+TEST_F(SnapshotTest, ReclamationUnderReads)
+{
+    Snapshot<Counted>        snapshot;
+    std::atomic<bool>        done{false};
+    std::atomic<int>         started{0};
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&] {
+            ++started;
+            // Each read lasts long enough that the readers' reads overlap
+            while (!done)
+                snapshot.read([](const Counted& counted) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(20));
+                    return counted.value;
+                });
+        });
+    }
+    while (started < 4)
+        std::this_thread::yield();
+    for (int i = 0; i < 1000; ++i)
+        snapshot.update([](Counted& counted) { ++counted.value; });
+
+    // The readers that outlive the last batch reclaim it
+    for (int i = 0; i < 1000 && Counted::live > 1; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_EQ(1, Counted::live);
+
+    done = true;
+    for (auto& thread : readers)
+        thread.join();
+    EXPECT_EQ(1000, snapshot.read([](const Counted& counted) { return counted.value; }));
+}
+
+// Tests concurrent use of the base dimension and base unit registries
+TEST_F(SnapshotTest, Registries)
+{
+    std::vector<std::thread> threads;
+    std::atomic<int>         created{0};
+
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < 100; ++j) {
+                const auto length = Dimensionality::get("Length", "L");
+                EXPECT_TRUE(length.isBaseDim());
+                EXPECT_EQ("L", length.to_string());
+                try {
+                    BaseInfo meter(length, "meter", "m");
+                    ++created;
+                }
+                catch (const std::invalid_argument& ex) {
+                    // Another thread has a meter at the moment
+                }
+                BaseInfo unit(length, "unit" + std::to_string(i), "u" + std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_GT(created, 0);
+    BaseInfo meter(Dimensionality::get("Length", "L"), "meter", "m"); // All were released
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
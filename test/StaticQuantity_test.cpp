@@ -0,0 +1,242 @@
+/**
+ * This file tests class StaticQuantity.
+ *
+ *        File: StaticQuantity_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BaseInfo.h"
+#include "Dimensionality.h"
+#include "StaticQuantity.h"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+
+using namespace quantity;
+
+// Base quantities are length, mass, and time, in that order
+using Length = Dim<1>;
+using Time = Dim<0, 0, 1>;
+using Speed = Dim<1, 0, -1>;
+
+using Meters = StaticQuantity<double, Length>;
+using Millimeters = StaticQuantity<double, Length, Scale<1, 1000>>;
+using Kilometers = StaticQuantity<double, Length, std::kilo>;
+using Seconds = StaticQuantity<double, Time>;
+using Hours = StaticQuantity<double, Time, Scale<3600>>;
+using MetersPerSecond = StaticQuantity<double, Speed>;
+using IntMeters = StaticQuantity<int, Length>;
+using IntMillimeters = StaticQuantity<int, Length, Scale<1, 1000>>;
+using IntKilometers = StaticQuantity<int, Length, Scale<1000>>;
+
+/// Maps types to `void` for detecting valid expressions
+template<typename...>
+struct Void
+{
+    using type = void;
+};
+
+/// Whether quantities can be added
+template<typename A, typename B, typename = void>
+struct CanAdd : std::false_type {};
+
+template<typename A, typename B>
+struct CanAdd<A, B, typename Void<decltype(std::declval<A>() + std::declval<B>())>::type>
+    : std::true_type {};
+
+/// Whether quantities can be subtracted
+template<typename A, typename B, typename = void>
+struct CanSubtract : std::false_type {};
+
+template<typename A, typename B>
+struct CanSubtract<A, B, typename Void<decltype(std::declval<A>() - std::declval<B>())>::type>
+    : std::true_type {};
+
+/// Whether quantities can be compared for equality
+template<typename A, typename B, typename = void>
+struct CanEqual : std::false_type {};
+
+template<typename A, typename B>
+struct CanEqual<A, B, typename Void<decltype(std::declval<A>() == std::declval<B>())>::type>
+    : std::true_type {};
+
+/// Whether quantities can be ordered
+template<typename A, typename B, typename = void>
+struct CanLess : std::false_type {};
+
+template<typename A, typename B>
+struct CanLess<A, B, typename Void<decltype(std::declval<A>() < std::declval<B>())>::type>
+    : std::true_type {};
+
+// Dimensional arithmetic is done by the compiler
+static_assert(std::is_same<DimMultiply<Length, Time>, Dim<1, 0, 1>>::value, "");
+static_assert(std::is_same<DimDivide<Length, Time>, Speed>::value, "");
+static_assert(std::is_same<DimPow<Speed, 2>, Dim<2, 0, -2>>::value, "");
+static_assert(DimEqual<Dim<1>, Dim<1, 0, 0>>::value, "");
+static_assert(!DimEqual<Length, Time>::value, "");
+
+// Conversion factors are computed by the compiler
+static_assert(Millimeters(Kilometers(2)).value() == 2e6, "");
+static_assert(quantity_cast<Kilometers>(Meters(1500)).value() == 1.5, "");
+static_assert((Meters(1) + Millimeters(500)).value() == 1500, "");
+static_assert(std::is_same<CommonScale<std::kilo, Scale<1, 1000>>, Scale<1, 1000>>::value, "");
+static_assert(std::is_same<CommonScale<Scale<3600>, Scale<60>>, Scale<60>>::value, "");
+static_assert(std::is_same<CommonScale<Scale<2, 3>, Scale<3, 4>>, Scale<1, 12>>::value, "");
+
+// Quantities of different dimensionalities don't interoperate
+static_assert(!std::is_convertible<Seconds, Meters>::value, "");
+static_assert(!std::is_constructible<Meters, Seconds>::value, "");
+static_assert(CanAdd<Meters, Millimeters>::value, "");
+static_assert(!CanAdd<Meters, Seconds>::value, "");
+static_assert(CanSubtract<Meters, Millimeters>::value, "");
+static_assert(!CanSubtract<Meters, Seconds>::value, "");
+static_assert(CanEqual<Meters, Millimeters>::value, "");
+static_assert(!CanEqual<Meters, Seconds>::value, "");
+static_assert(CanLess<Meters, Millimeters>::value, "");
+static_assert(!CanLess<Hours, Kilometers>::value, "");
+
+// Integral quantities convert implicitly only if no precision is lost
+static_assert(std::is_convertible<IntKilometers, IntMeters>::value, "");
+static_assert(!std::is_convertible<IntMeters, IntKilometers>::value, "");
+static_assert(!std::is_constructible<IntMeters, IntMillimeters>::value, "");
+static_assert(std::is_convertible<Meters, Kilometers>::value, "");
+
+// An instance is just its numeric value
+static_assert(sizeof(MetersPerSecond) == sizeof(double), "");
+static_assert(std::is_trivially_copyable<MetersPerSecond>::value, "");
+
+/// The fixture for testing class `StaticQuantity`
+class StaticQuantityTest : public ::testing::Test
+{
+protected:
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    StaticQuantityTest()
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~StaticQuantityTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    Dimensionality             length{Dimensionality::get("Length", "L")};
+    Dimensionality             mass{Dimensionality::get("Mass", "M")};
+    Dimensionality             time{Dimensionality::get("Time", "T")};
+    BaseInfo                   meterInfo{length, "meter", "m"};
+    BaseInfo                   kgInfo{mass, "kilogram", "kg"};
+    BaseInfo                   secondInfo{time, "second", "s"};
+    Unit::Pimpl                meter{Unit::get(meterInfo)};
+    Unit::Pimpl                kg{Unit::get(kgInfo)};
+    Unit::Pimpl                second{Unit::get(secondInfo)};
+    std::array<Unit::Pimpl, 3> bases{{meter, kg, second}};
+};
+
+// Tests arithmetic
+TEST_F(StaticQuantityTest, Arithmetic)
+{
+    const Kilometers distance(36);
+    const Hours      duration(0.5);
+
+    const auto speed = distance/duration;
+    EXPECT_TRUE((std::is_same<decltype(speed)::dim, Speed>::value));
+    EXPECT_DOUBLE_EQ(72, speed.value());
+    EXPECT_DOUBLE_EQ(20, MetersPerSecond(speed).value());
+
+    EXPECT_DOUBLE_EQ(36500, Meters(distance + Millimeters(500e3)).value());
+    EXPECT_TRUE((std::is_same<decltype(distance - Meters(500)), Meters>::value));
+    EXPECT_DOUBLE_EQ(35.5, Kilometers(distance - Meters(500)).value());
+    EXPECT_DOUBLE_EQ(72, (2.0*distance).value());
+    EXPECT_DOUBLE_EQ(18, (distance/2.0).value());
+    const StaticQuantity<double, Dim<2>> area = pow<2>(Millimeters(2));
+    EXPECT_DOUBLE_EQ(4e-6, area.value());
+    EXPECT_DOUBLE_EQ(0.25, pow<-2>(Meters(2)).value());
+
+    EXPECT_TRUE(Meters(1000) == Kilometers(1));
+    EXPECT_TRUE(Kilometers(1) == Meters(1000));
+    EXPECT_TRUE(Millimeters(999) < Meters(1));
+    EXPECT_FALSE(Meters(1) < Millimeters(999));
+}
+
+// Tests scale conversion of integral values
+TEST_F(StaticQuantityTest, Integral)
+{
+    static_assert(quantity_cast<IntMeters>(IntMillimeters(1500)).value() == 1,
+            "Scale factor truncated");
+    EXPECT_EQ(1, quantity_cast<IntMeters>(IntMillimeters(1500)).value());
+    EXPECT_EQ(-1, quantity_cast<IntMeters>(IntMillimeters(-1500)).value());
+    EXPECT_EQ(2, quantity_cast<IntKilometers>(IntMeters(2500)).value());
+    EXPECT_EQ(2000000, IntMillimeters(IntKilometers(2)).value());
+
+    // Sums and comparisons are exact and symmetric
+    EXPECT_EQ(2500, (IntMillimeters(1500) + IntMeters(1)).value());
+    EXPECT_EQ(2500, (IntMeters(1) + IntMillimeters(1500)).value());
+    EXPECT_TRUE((std::is_same<decltype(IntKilometers(1) + IntMeters(999)), IntMeters>::value));
+    EXPECT_EQ(1999, (IntKilometers(1) + IntMeters(999)).value());
+    EXPECT_EQ(1, (IntKilometers(1) - IntMeters(999)).value());
+    EXPECT_TRUE(IntMeters(1) == IntMillimeters(1000));
+    EXPECT_FALSE(IntKilometers(1) == IntMeters(1001));
+    EXPECT_FALSE(IntMeters(1001) == IntKilometers(1));
+    EXPECT_TRUE(IntKilometers(1) < IntMeters(1001));
+    EXPECT_FALSE(IntMeters(1001) < IntKilometers(1));
+}
+
+// Tests interoperation with runtime units
+TEST_F(StaticQuantityTest, Runtime)
+{
+    EXPECT_EQ(0, Meters::getUnit(bases)->compare(meter));
+    EXPECT_EQ(0, MetersPerSecond::getUnit(bases)->compare(meter->divideBy(second)));
+
+    const auto km = Kilometers::getUnit(bases);
+    EXPECT_DOUBLE_EQ(2000, km->getConverterTo(meter)(2));
+
+    const auto feet = Unit::get(meter, 1/0.3048, 0);
+    EXPECT_DOUBLE_EQ(304.8, Millimeters::fromUnit(1, feet, bases).value());
+    const auto hour = Hours::getUnit(bases);
+    EXPECT_DOUBLE_EQ(3600, hour->getConverterTo(second)(1));
+
+    EXPECT_THROW(Meters::fromUnit(1, second, bases), std::invalid_argument);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,154 @@
+/**
+ * This file tests class ThreadPool.
+ *
+ *        File: ThreadPool_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `ThreadPool`
+class ThreadPoolTest : public ::testing::Test
+{
+protected:
+    /**
+     * Executes a parallel loop and verifies that every task was executed exactly once.
+     * @param[in] pool      The thread pool
+     * @param[in] numTasks  Number of tasks
+     */
+    static void checkOnce(ThreadPool& pool, const size_t numTasks)
+    {
+        std::unique_ptr<std::atomic<int>[]> counts(new std::atomic<int>[numTasks]);
+        for (size_t i = 0; i < numTasks; ++i)
+            counts[i] = 0;
+        pool.parallelFor(numTasks, [&](const size_t task) {
+            ++counts[task];
+        });
+        for (size_t i = 0; i < numTasks; ++i)
+            EXPECT_EQ(1, counts[i]) << i;
+    }
+
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    ThreadPoolTest()
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~ThreadPoolTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+};
+
+// Tests construction
+TEST_F(ThreadPoolTest, Construction)
+{
+    ThreadPool pool(2);
+    EXPECT_EQ(2, pool.size());
+    EXPECT_EQ(ThreadPool::defaultNumThreads(), ThreadPool::getInstance().size());
+    EXPECT_EQ(&ThreadPool::getInstance(), &ThreadPool::getInstance());
+}
+
+// Tests that every task is executed exactly once
+TEST_F(ThreadPoolTest, ExecutesOnce)
+{
+    for (const size_t numThreads : {0, 1, 3}) {
+        ThreadPool pool(numThreads);
+        for (const size_t numTasks : {0, 1, 2, 5, 1000})
+            checkOnce(pool, numTasks);
+    }
+}
+
+// Tests that an exception thrown by a task is rethrown after every task is executed
+TEST_F(ThreadPoolTest, Exception)
+{
+    ThreadPool          pool(3);
+    std::atomic<size_t> count(0);
+    EXPECT_THROW(pool.parallelFor(100, [&](const size_t task) {
+        ++count;
+        if (task % 10 == 0)
+            throw std::runtime_error("Task failed");
+    }), std::runtime_error);
+    EXPECT_EQ(100, count);
+
+    checkOnce(pool, 100); // The pool is still usable
+}
+
+// Tests a parallel loop within a task
+TEST_F(ThreadPoolTest, Nested)
+{
+    ThreadPool          pool(2);
+    std::atomic<size_t> count(0);
+    pool.parallelFor(8, [&](size_t) {
+        pool.parallelFor(8, [&](size_t) {
+            ++count;
+        });
+    });
+    EXPECT_EQ(64, count);
+}
+
+// Tests parallel loops that are started concurrently
+TEST_F(ThreadPoolTest, Concurrent)
+{
+    ThreadPool               pool(2);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+        threads.emplace_back([&pool]{
+            for (int j = 0; j < 20; ++j)
+                checkOnce(pool, 50);
+        });
+    for (auto& thread : threads)
+        thread.join();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
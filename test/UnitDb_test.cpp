@@ -0,0 +1,201 @@
+/**
+ * This file tests class UnitDb.
+ *
+ *        File: UnitDb_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "UnitDb.h"
+#include "UnitParser.h"
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `UnitDb`
+class UnitDbTest : public ::testing::Test
+{
+protected:
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    UnitDbTest()
+        : snapshot("/tmp/UnitDb_test-" + std::to_string(::getpid()) + ".bin")
+    {
+        // You can do set-up work for each test here.
+    }
+
+    virtual ~UnitDbTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+        std::remove(snapshot.c_str());
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+        if (!UnitDb::haveYaml())
+            GTEST_SKIP() << "Library was built without yaml-cpp";
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    const std::string yaml{QUANTITIES_YAML};
+    const std::string snapshot;
+
+    /**
+     * Verifies the contents of a database built from src/quantities.yaml.
+     * @param[in] db  The database
+     */
+    static void verify(const UnitDb& db)
+    {
+        const auto kelvin = db.getUnit("°K");
+        EXPECT_EQ(kelvin, db.getUnit("degrees kelvin"));
+        EXPECT_EQ(kelvin, db.getQuantityUnit("temperature"));
+        EXPECT_EQ("Θ", db.getDimensionality("temperature").to_string());
+
+        const auto watt = db.getUnit("W");
+        EXPECT_EQ("kg·m^2·s^-3", watt->to_string());
+        EXPECT_EQ(watt, db.getUnit("kg")->multiply(db.getUnit("m")->pow(2))->divideBy(
+                db.getUnit("s")->pow(3)));
+        EXPECT_EQ("L^2·M·T^-3", db.getDimensionality("power").to_string());
+        EXPECT_EQ("m^3", db.getQuantityUnit("volume")->to_string());
+
+        const auto celsius = db.getUnit("°C");
+        EXPECT_DOUBLE_EQ(273.15, celsius->getConverterTo(kelvin)(0));
+        const auto fahrenheit = db.getUnit("°F");
+        EXPECT_NEAR(0, fahrenheit->getConverterTo(celsius)(32), 1e-9);
+        EXPECT_NEAR(100, fahrenheit->getConverterTo(celsius)(212), 1e-9);
+
+        const auto dBZ = db.getUnit("Bz");
+        EXPECT_EQ(Unit::Type::REF_LOG, dBZ->type());
+        EXPECT_NEAR(1e-6, dBZ->getConverterTo(db.getQuantityUnit("volume"))(0), 1e-18);
+
+        ASSERT_EQ(2, db.getUnsupported().size());
+        EXPECT_EQ("seconds since the epoch", db.getUnsupported()[0]);
+        EXPECT_EQ("days since the epoch", db.getUnsupported()[1]);
+
+        EXPECT_THROW(db.getUnit("furlong"), std::out_of_range);
+        EXPECT_THROW(db.getQuantityUnit("days since the epoch"), std::out_of_range);
+    }
+};
+
+// Tests loading the YAML definition file
+TEST_F(UnitDbTest, Yaml)
+{
+    verify(UnitDb::fromYaml(yaml));
+    EXPECT_THROW(UnitDb::fromYaml("/nonexistent.yaml"), std::runtime_error);
+}
+
+// Tests that only one database can exist at a time
+TEST_F(UnitDbTest, Duplicate)
+{
+    const auto db = UnitDb::fromYaml(yaml);
+    EXPECT_THROW(UnitDb::fromYaml(yaml), std::invalid_argument);
+}
+
+// Tests binary snapshots
+TEST_F(UnitDbTest, Snapshot)
+{
+    UnitDb::compile(yaml, snapshot);
+    verify(UnitDb::fromSnapshot(snapshot));
+
+    EXPECT_THROW(UnitDb::fromSnapshot("/nonexistent.bin"), std::runtime_error);
+    std::ofstream(snapshot) << "Not a snapshot";
+    EXPECT_THROW(UnitDb::fromSnapshot(snapshot), std::runtime_error);
+}
+
+// Tests rational powers of the dimensionality of a derived quantity
+TEST_F(UnitDbTest, RationalPower)
+{
+    const auto definitions = snapshot + ".yaml";
+    std::ofstream(definitions) <<
+            "base_quantities:\n"
+            "  - name: distance\n"
+            "    symbol: D\n"
+            "    unit: {name: rod, symbol: rd}\n"
+            "derived_quantities:\n"
+            "  - name: root distance\n"
+            "    dimensionality:\n"
+            "      - {quantity: distance, power: 1/2}\n"
+            "  - name: area\n"
+            "    dimensionality:\n"
+            "      - {quantity: root distance, power: \"4\"}\n";
+
+    {
+        const auto db = UnitDb::fromYaml(definitions);
+        EXPECT_EQ("rd^(1/2)", db.getQuantityUnit("root distance")->to_string());
+        EXPECT_EQ("D^(1/2)", db.getDimensionality("root distance").to_string());
+        EXPECT_EQ(db.getUnit("rd")->pow(2), db.getQuantityUnit("area"));
+    }
+
+    UnitDb::compile(definitions, snapshot);
+    {
+        const auto db = UnitDb::fromSnapshot(snapshot);
+        EXPECT_EQ("rd^(1/2)", db.getQuantityUnit("root distance")->to_string());
+        EXPECT_EQ(db.getUnit("rd")->pow(2), db.getQuantityUnit("area"));
+    }
+
+    for (const auto power : {"1/0", "1/", "x", "1.5", "100000"}) {
+        std::ofstream(definitions) <<
+                "base_quantities:\n"
+                "  - name: distance\n"
+                "    symbol: D\n"
+                "    unit: {name: rod, symbol: rd}\n"
+                "derived_quantities:\n"
+                "  - name: bad\n"
+                "    dimensionality:\n"
+                "      - {quantity: distance, power: \"" << power << "\"}\n";
+        EXPECT_THROW(UnitDb::fromYaml(definitions), std::invalid_argument) << power;
+    }
+    std::remove(definitions.c_str());
+}
+
+// Tests defining the symbols of a database in a parser
+TEST_F(UnitDbTest, Parser)
+{
+    const auto db = UnitDb::fromYaml(yaml);
+    UnitParser parser;
+    db.define(parser);
+    EXPECT_EQ(db.getUnit("W"), parser.parse("kg·m^2·s^-3"));
+    EXPECT_EQ(db.getUnit("°C"), parser.parse("°C"));
+    EXPECT_EQ(Unit::get(Unit::BaseEnum::TEN, db.getDimensionality("power")),
+            parser.parse("lg((L^2·M·T^-3)^0)"));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,226 @@
+/**
+ * This file tests class UnitParser.
+ *
+ *        File: UnitParser_test.cpp
+ *  Created on: Oct 16, 2026
+ *      Author: Steven R. Emmerson
+ *
+ * Copyright 2026 Steven R. Emmerson. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BaseInfo.h"
+#include "Dimensionality.h"
+#include "UnitParser.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace quantity;
+
+/// The fixture for testing class `UnitParser`
+class UnitParserTest : public ::testing::Test
+{
+protected:
+    // You can remove any or all of the following functions if its body
+    // is empty.
+
+    UnitParserTest()
+    {
+        // You can do set-up work for each test here.
+        parser.define(meterInfo);
+        parser.define(kgInfo);
+        parser.define(secondInfo);
+        parser.define(kelvinInfo);
+        parser.define("°C", celsius);
+        parser.define("mW", milliwatt);
+        parser.define("L", length);
+        parser.define("T", time);
+    }
+
+    virtual ~UnitParserTest()
+    {
+        // You can do clean-up work that doesn't throw exceptions here.
+    }
+
+    // If the constructor and destructor are not enough for setting up
+    // and cleaning up each test, you can define the following methods:
+
+    virtual void SetUp()
+    {
+        // Code here will be called immediately after the constructor (right
+        // before each test).
+    }
+
+    virtual void TearDown()
+    {
+        // Code here will be called immediately after each test (right
+        // before the destructor).
+    }
+
+    // Objects declared here can be used by all tests in the test case for Error.
+    Dimensionality length{Dimensionality::get("Length", "L")};
+    Dimensionality mass{Dimensionality::get("Mass", "M")};
+    Dimensionality time{Dimensionality::get("Time", "T")};
+    Dimensionality temp{Dimensionality::get("Temperature", "Θ")};
+    BaseInfo       meterInfo{length, "meter", "m"};
+    BaseInfo       kgInfo{mass, "kilogram", "kg"};
+    BaseInfo       secondInfo{time, "second", "s"};
+    BaseInfo       kelvinInfo{temp, "kelvin", "K"};
+    Unit::Pimpl    meter{Unit::get(meterInfo)};
+    Unit::Pimpl    kg{Unit::get(kgInfo)};
+    Unit::Pimpl    second{Unit::get(secondInfo)};
+    Unit::Pimpl    kelvin{Unit::get(kelvinInfo)};
+    Unit::Pimpl    celsius{Unit::get(kelvin, 1, 273.15)};
+    Unit::Pimpl    watt{kg->multiply(meter->pow(2))->divideBy(second->pow(3))};
+    Unit::Pimpl    milliwatt{Unit::get(watt, 1e-3, 0)};
+    UnitParser     parser;
+};
+
+// Tests canonical units
+TEST_F(UnitParserTest, Canonical)
+{
+    EXPECT_EQ(meter, parser.parse("m"));
+    EXPECT_EQ(watt, parser.parse("kg·m^2·s^-3"));
+    EXPECT_EQ(watt, parser.parse(" m^2·kg·s^-3 "));
+    EXPECT_EQ(meter->pow(Exponent(1, 2)), parser.parse("m^(1/2)"));
+    EXPECT_EQ(meter->pow(Exponent(-2, 3)), parser.parse("m^(-2/3)"));
+}
+
+// Tests affine units
+TEST_F(UnitParserTest, Affine)
+{
+    EXPECT_EQ(celsius, parser.parse("°C"));
+    EXPECT_EQ(celsius, parser.parse("K + 273.15"));
+    EXPECT_EQ(Unit::get(meter, 0.5, 0), parser.parse("0.5 m"));
+    EXPECT_EQ(Unit::get(meter, 2, -3), parser.parse("2 m - 3"));
+    EXPECT_EQ(meter, parser.parse("1 m"));
+    EXPECT_EQ(Unit::get(meter->divideBy(second), 2, 0), parser.parse("2 m·s^-1"));
+}
+
+// Tests logarithmic units
+TEST_F(UnitParserTest, Logarithmic)
+{
+    EXPECT_EQ(Unit::get(Unit::BaseEnum::TEN, milliwatt), parser.parse("lg(re 1 mW)"));
+    EXPECT_EQ(Unit::get(Unit::BaseEnum::E, meter->divideBy(second)),
+            parser.parse("ln(re m·s^-1)"));
+    EXPECT_EQ(Unit::get(Unit::BaseEnum::TWO, length), parser.parse("lb(L^0)"));
+    EXPECT_EQ(Unit::get(Unit::BaseEnum::TEN, length.pow(2)), parser.parse("lg(L^2^0)"));
+    EXPECT_EQ(Unit::get(Unit::BaseEnum::TEN, length.divideBy(time)),
+            parser.parse("lg((L·T^-1)^0)"));
+}
+
+// Tests that the output of to_string() can be parsed
+TEST_F(UnitParserTest, RoundTrip)
+{
+    const Unit::Pimpl units[] = {
+        meter,
+        watt,
+        meter->pow(Exponent(1, 2)),
+        celsius,
+        Unit::get(meter, 0.5, 0),
+        Unit::get(meter, 2, -3),
+        Unit::get(Unit::BaseEnum::TEN, milliwatt),
+        Unit::get(Unit::BaseEnum::E, meter->divideBy(second)),
+        Unit::get(Unit::BaseEnum::TWO, length),
+        Unit::get(Unit::BaseEnum::TEN, length.divideBy(time)),
+        Unit::get(Unit::BaseEnum::TEN, Unit::get(meter, 2, 0))
+    };
+    for (const auto& unit : units) {
+        const auto spec = unit->to_string();
+        EXPECT_EQ(0, unit->compare(parser.parse(spec))) << spec;
+    }
+}
+
+// Tests invalid specifications
+TEST_F(UnitParserTest, Invalid)
+{
+    EXPECT_THROW(parser.parse(""), std::invalid_argument);
+    EXPECT_THROW(parser.parse("ft"), std::invalid_argument);
+    EXPECT_THROW(parser.parse("m·"), std::invalid_argument);
+    EXPECT_THROW(parser.parse("m^"), std::invalid_argument);
+    EXPECT_THROW(parser.parse("m^(1/0)"), std::invalid_argument);
+    EXPECT_THROW(parser.parse("m s"), std::invalid_argument);
+    EXPECT_THROW(parser.parse("lg(re m"), std::invalid_argument);
+    EXPECT_THROW(parser.parse("lg(L)"), std::invalid_argument);
+    EXPECT_THROW(parser.parse("lg(X^0)"), std::invalid_argument);
+    EXPECT_THROW(parser.parse("K +"), std::invalid_argument);
+
+    EXPECT_THROW(parser.define("", meter), std::invalid_argument);
+    EXPECT_THROW(parser.define("2m", meter), std::invalid_argument);
+    EXPECT_THROW(parser.define("m^2", meter), std::invalid_argument);
+    EXPECT_THROW(UnitParser(0), std::invalid_argument);
+}
+
+// Tests the cache
+TEST_F(UnitParserTest, Cache)
+{
+    UnitParser small(2);
+    small.define(meterInfo);
+    small.define(secondInfo);
+
+    const auto speed = small.parse("m·s^-1");
+    EXPECT_EQ(speed, small.parse("m·s^-1"));
+    auto stats = small.getStats();
+    EXPECT_EQ(1, stats.hits);
+    EXPECT_EQ(1, stats.misses);
+    EXPECT_EQ(1, stats.size);
+
+    small.parse("m");
+    small.parse("s");
+    stats = small.getStats();
+    EXPECT_EQ(3, stats.misses);
+    EXPECT_EQ(2, stats.size); // "m·s^-1" was evicted
+
+    small.clear();
+    stats = small.getStats();
+    EXPECT_EQ(0, stats.hits);
+    EXPECT_EQ(0, stats.misses);
+    EXPECT_EQ(0, stats.size);
+}
+
+// Tests concurrent parsing and redefinition
+TEST_F(UnitParserTest, Concurrent)
+{
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([this]{
+            for (int j = 0; j < 200; ++j) {
+                EXPECT_EQ(watt, parser.parse("kg·m^2·s^-3"));
+                EXPECT_EQ(celsius, parser.parse("°C"));
+            }
+        });
+    }
+    threads.emplace_back([this]{
+        for (int j = 0; j < 50; ++j)
+            parser.define("°C", celsius);
+    });
+    for (auto& thread : threads)
+        thread.join();
+
+    // A redefinition isn't hidden by a result that was cached before it
+    parser.parse("mW");
+    parser.define("mW", watt);
+    EXPECT_EQ(watt, parser.parse("mW"));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}